@@ -34,6 +34,8 @@
 #include "model/ndn-l3-protocol.hpp"
 #include "helper/ndn-fib-helper.hpp"
 
+#include <ndn-cxx/encoding/encoding-buffer.hpp>
+
 #include <memory>
 
 NS_LOG_COMPONENT_DEFINE("ndn.Producer");
@@ -87,6 +89,35 @@ Producer::StartApplication()
   App::StartApplication();
 
   FibHelper::AddRoute(GetNode(), m_prefix, m_face, 0);
+
+  BuildDataTemplate();
+}
+
+void
+Producer::BuildDataTemplate()
+{
+  // everything except the Name is the same for all Data packets, so encode it only once
+  Data data;
+  data.setFreshnessPeriod(::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
+
+  data.setContent(make_shared< ::ndn::Buffer>(m_virtualPayloadSize));
+
+  Signature signature;
+  SignatureInfo signatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255));
+
+  if (m_keyLocator.size() > 0) {
+    signatureInfo.setKeyLocator(m_keyLocator);
+  }
+
+  signature.setInfo(signatureInfo);
+  signature.setValue(::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, m_signature));
+
+  data.setSignature(signature);
+
+  const Block& wire = data.wireEncode();
+  wire.parse();
+  const Block& name = wire.elements().front(); // Name is always the first element
+  m_dataTemplate = make_shared< ::ndn::Buffer>(name.end(), wire.value_end());
 }
 
 void
@@ -111,27 +142,18 @@ Producer::OnInterest(shared_ptr<const Interest> interest)
   if (!m_active)
     return;
 
-  Name dataName(interest->getName());
+  const Block& dataName = interest->getName().wireEncode();
   // dataName.append(m_postfix);
   // dataName.appendVersion();
 
-  auto data = make_shared<Data>();
-  data->setName(dataName);
-  data->setFreshnessPeriod(::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
-
-  data->setContent(make_shared< ::ndn::Buffer>(m_virtualPayloadSize));
+  // splice the Name into the pre-encoded template to create real wire encoding
+  ::ndn::EncodingBuffer encoder(dataName.size() + m_dataTemplate->size() + 2 * 9, 0);
+  size_t length = encoder.prependByteArray(m_dataTemplate->data(), m_dataTemplate->size());
+  length += encoder.prependByteArray(dataName.wire(), dataName.size());
+  encoder.prependVarNumber(length);
+  encoder.prependVarNumber(::ndn::tlv::Data);
 
-  Signature signature;
-  SignatureInfo signatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255));
-
-  if (m_keyLocator.size() > 0) {
-    signatureInfo.setKeyLocator(m_keyLocator);
-  }
-
-  signature.setInfo(signatureInfo);
-  signature.setValue(::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, m_signature));
-
-  data->setSignature(signature);
+  auto data = make_shared<Data>(encoder.block());
 
   // ns3::Ptr<ns3::Node> node = ns3::NodeList::GetNode(ns3::Simulator::GetContext());
   // const nfd::Pit& tempPit = node->GetObject<ndn::L3Protocol>()->getForwarder()->getPit();
@@ -140,9 +162,6 @@ Producer::OnInterest(shared_ptr<const Interest> interest)
   // NS_LOG_DEBUG(Simulator::Now().ToDouble(Time::S) << "\t" << "Data Sent" << "\t" << Nname << "\t" << node->GetId() << "\t" << data->getName().toUri() << "\t" << seq);
   NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Data: " << data->getName());
 
-  // to create real wire encoding
-  data->wireEncode();
-
   m_transmittedDatas(data, this, m_face);
   m_appLink->onReceiveData(*data);
 }
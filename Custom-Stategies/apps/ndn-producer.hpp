@@ -59,6 +59,16 @@ protected:
   virtual void
   StopApplication(); // Called at time specified by Stop
 
+private:
+  /**
+   * @brief Pre-encode MetaInfo, Content, SignatureInfo, and SignatureValue of Data packets
+   *
+   * These parts do not depend on the Interest; attributes changed after the application has
+   * started take effect on the next start
+   */
+  void
+  BuildDataTemplate();
+
 private:
   Name m_prefix;
   Name m_postfix;
@@ -67,6 +77,8 @@ private:
 
   uint32_t m_signature;
   Name m_keyLocator;
+
+  shared_ptr<const ::ndn::Buffer> m_dataTemplate; ///< @brief encoded Data elements after the Name
 };
 
 } // namespace ndn
@@ -52,6 +52,15 @@ getDefaultStrategyName()
   return fw::BestRouteStrategy2::getStrategyName();
 }
 
+/** \return whether traffic of class \p cls is held back while the medium is busy
+ */
+static inline bool
+isDeferrable(TrafficClass cls)
+{
+  return cls == TRAFFIC_CLASS_HUGE || cls == TRAFFIC_CLASS_MID0 ||
+         cls == TRAFFIC_CLASS_MID1 || cls == TRAFFIC_CLASS_MID2;
+}
+
 Forwarder::Forwarder()
   : m_unsolicitedDataPolicy(new fw::DefaultUnsolicitedDataPolicy())
   , m_fib(m_nameTree)
@@ -62,6 +71,8 @@ Forwarder::Forwarder()
 {
   getFaceTable().addReserved(m_csFace, face::FACEID_CONTENT_STORE);
 
+  m_pit.setTrafficClassifier(&m_trafficClassifier);
+
   m_faceTable.afterAdd.connect([this] (Face& face) {
     face.afterReceiveInterest.connect(
       [this, &face] (const Interest& interest) {
@@ -155,7 +166,7 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
                 bind(&Forwarder::onContentStoreMiss, this, ref(inFace), pitEntry, _1));
     }
     else {
-      shared_ptr<Data> match = m_csFromNdnSim->Lookup(interest.shared_from_this());
+      shared_ptr<const Data> match = m_csFromNdnSim->LookupShared(interest.shared_from_this());
       if (match != nullptr) {
         ////////////////////////////////////////////////////////////////////////////
         ////////////////////////////////////////////////////////////////////////////
@@ -163,23 +174,17 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
         ////////////////////////////////////////////////////////////////////////////
         ////////////////////////////////////////////////////////////////////////////
 
-        std::string content_name = interest.getName().toUri();
+        TrafficClass cls = Pit::getTrafficClass(*pitEntry);
 
         // Huge Data Request Interests
-        if ( (content_name.find("Huge") != std::string::npos) || (content_name.find("Mid") != std::string::npos) )
+        if ( isDeferrable(cls) )
         {
-          ns3::Ptr<ns3::Node> n = ns3::NodeList::GetNode(0);
-          const nfd::Pit& p = n->GetObject<ns3::ndn::L3Protocol>()->getForwarder()->getPit();
           // Ptr<ns3::NetDevice> dev = n->GetDevice (0);
           // Ptr<ns3::WifiNetDevice> wifi_dev = DynamicCast<WifiNetDevice> (dev);
           // uint32_t qsize = wifi_dev->GetQueueSize();
-          int cnt = 0; // num of sensitive packet
-          for(auto it = p.begin(); it != p.end(); it++)
-          {
-            if( it->getName().toUri().find("root") != std::string::npos ) cnt++;
-          }
+          size_t cnt = this->getNSensitivePending(); // num of sensitive packet
           // If Network is busy. m_pit
-          if ( cnt >=7 )
+          if ( cnt >= SENSITIVE_BUSY_THRESHOLD )
           {
             if((is_mid == 0) && (is_huge == 1) )
             {
@@ -190,7 +195,7 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
               this->setExpiryTimer(pitEntry, 0_ms);
               return;
             }
-            else if(is_mid == 1 && is_huge == 1 && (content_name.find("Mid0") == std::string::npos) )
+            else if(is_mid == 1 && is_huge == 1 && (cls != TRAFFIC_CLASS_MID0) )
             {
               // Sending Packet that implies the sending of Huge Data will be started later.
               lp::Nack nack(interest);
@@ -199,7 +204,7 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
               this->setExpiryTimer(pitEntry, 0_ms);
               return;
             }
-            else if(is_mid == 1 && is_huge == 1 && (content_name.find("Mid0") != std::string::npos) )
+            else if(is_mid == 1 && is_huge == 1 && (cls == TRAFFIC_CLASS_MID0) )
             {
               // Sending Packet that implies the sending of Huge Data will be started later.
               is_mid--;
@@ -209,7 +214,7 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
               this->setExpiryTimer(pitEntry, 0_ms);
               return;
             }
-            else if(is_mid == 2 && is_huge == 1 && ((content_name.find("Mid2") != std::string::npos) || (content_name.find("Huge") != std::string::npos) ) )
+            else if(is_mid == 2 && is_huge == 1 && ((cls == TRAFFIC_CLASS_MID2) || (cls == TRAFFIC_CLASS_HUGE) ) )
             {
               // Sending Packet that implies the sending of Huge Data will be started later.
               lp::Nack nack(interest);
@@ -218,7 +223,7 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
               this->setExpiryTimer(pitEntry, 0_ms);
               return;
             }
-            else if(is_mid == 2 && is_huge == 1 && (content_name.find("Mid1") != std::string::npos) )
+            else if(is_mid == 2 && is_huge == 1 && (cls == TRAFFIC_CLASS_MID1) )
             {
               // Sending Packet that implies the sending of Huge Data will be started later.
               is_mid--;
@@ -228,7 +233,7 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
               this->setExpiryTimer(pitEntry, 0_ms);
               return;
             }
-            else if(is_mid == 3 && is_huge == 1 && (content_name.find("Huge") != std::string::npos) )
+            else if(is_mid == 3 && is_huge == 1 && (cls == TRAFFIC_CLASS_HUGE) )
             {
               // Sending Packet that implies the sending of Huge Data will be started later.
               lp::Nack nack(interest);
@@ -237,7 +242,7 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
               this->setExpiryTimer(pitEntry, 0_ms);
               return;
             }
-            else if(is_mid == 3 && is_huge == 1 && (content_name.find("Mid2") != std::string::npos) )
+            else if(is_mid == 3 && is_huge == 1 && (cls == TRAFFIC_CLASS_MID2) )
             {
               // Sending Packet that implies the sending of Huge Data will be started later.
               is_mid--;
@@ -247,7 +252,7 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
               this->setExpiryTimer(pitEntry, 0_ms);
               return;
             }
-            else if((is_huge == 0) && (content_name.find("Huge") != std::string::npos))
+            else if((is_huge == 0) && (cls == TRAFFIC_CLASS_HUGE))
             {
               // Sending Packet that implies the sending of Huge Data will be started later.
               is_huge = 1;
@@ -260,7 +265,7 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
           }
           else
           {
-            if((is_mid == 0) && (is_huge == 1) && (content_name.find("Mid0") == std::string::npos) )
+            if((is_mid == 0) && (is_huge == 1) && (cls != TRAFFIC_CLASS_MID0) )
             {
               // Sending Packet that implies the sending of Huge Data will be started later.
               lp::Nack nack(interest);
@@ -269,12 +274,12 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
               this->setExpiryTimer(pitEntry, 0_ms);
               return;
             }
-            else if(is_mid == 0 && is_huge == 1 && (content_name.find("Mid0") != std::string::npos) )
+            else if(is_mid == 0 && is_huge == 1 && (cls == TRAFFIC_CLASS_MID0) )
             {
               // Sending Packet that implies the sending of Huge Data will be started later.
               is_mid++;
             }
-            else if(is_mid == 1 && is_huge == 1 && ((content_name.find("Mid0") != std::string::npos) || (content_name.find("Mid1") != std::string::npos)) )
+            else if(is_mid == 1 && is_huge == 1 && ((cls == TRAFFIC_CLASS_MID0) || (cls == TRAFFIC_CLASS_MID1)) )
             {
               // Sending Packet that implies the sending of Huge Data will be started later.
               is_mid++;
@@ -288,7 +293,7 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
               this->setExpiryTimer(pitEntry, 0_ms);
               return;
             }
-            else if(is_mid == 2 && is_huge == 1 && ((content_name.find("Mid2") != std::string::npos) || (content_name.find("Mid1") != std::string::npos) || (content_name.find("Mid0") != std::string::npos) ) )
+            else if(is_mid == 2 && is_huge == 1 && ((cls == TRAFFIC_CLASS_MID2) || (cls == TRAFFIC_CLASS_MID1) || (cls == TRAFFIC_CLASS_MID0) ) )
             {
               // Sending Packet that implies the sending of Huge Data will be started later.
               is_mid++;
@@ -302,7 +307,7 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
               this->setExpiryTimer(pitEntry, 0_ms);
               return;
             }
-            else if(is_mid == 3 && is_huge == 1 && (content_name.find("Huge") != std::string::npos) )
+            else if(is_mid == 3 && is_huge == 1 && (cls == TRAFFIC_CLASS_HUGE) )
             {
               // Sending Packet that implies the sending of Huge Data will be started later.
               lp::Nack nack(interest);
@@ -311,7 +316,7 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
               this->setExpiryTimer(pitEntry, 0_ms);
               return;
             }
-            else if(is_mid == 3 && is_huge == 1 && (content_name.find("Huge") == std::string::npos) )
+            else if(is_mid == 3 && is_huge == 1 && (cls != TRAFFIC_CLASS_HUGE) )
             {
               // Sending Packet that implies the sending of Huge Data will be started later.
               is_huge = 0;
@@ -438,7 +443,7 @@ Forwarder::onOutgoingInterest(const shared_ptr<pit::Entry>& pitEntry, Face& outF
   // insert out-record
   pitEntry->insertOrUpdateOutRecord(outFace, interest);
 
-    if( interest.getName().toUri().find("root") != std::string::npos )
+    if( Pit::getTrafficClass(*pitEntry) == TRAFFIC_CLASS_SENSITIVE )
     {
       // send Interest
       outFace.sendInterest(interest);
@@ -446,16 +451,11 @@ Forwarder::onOutgoingInterest(const shared_ptr<pit::Entry>& pitEntry, Face& outF
       return;
     }
 
-  ns3::Ptr<ns3::Node> n = ns3::NodeList::GetNode(0);
-  const nfd::Pit& p = n->GetObject<ns3::ndn::L3Protocol>()->getForwarder()->getPit();
-  int cnt = 0; // num of sensitive packet
+  size_t cnt = 0; // num of sensitive packet
   if(!this->m_pit.getTransmit())
   {
-    for(auto it = p.begin(); it != p.end(); it++)
-    {
-      if( it->getName().toUri().find("root") != std::string::npos ) cnt++;
-    }
-    if( cnt < 7 ) // interest.getPitSize()
+    cnt = this->getNSensitivePending();
+    if( cnt < SENSITIVE_BUSY_THRESHOLD ) // interest.getPitSize()
     {
       if(!m_rtxInterest.empty())
       {
@@ -473,7 +473,7 @@ Forwarder::onOutgoingInterest(const shared_ptr<pit::Entry>& pitEntry, Face& outF
       if((ns3::Simulator::Now().GetSeconds()-lock) > 60)
         m_pit.setTransmit(true);
     }
-    else if( cnt >= 7 )
+    else
     {
       this->setExpiryTimer(pitEntry, ndn::time::milliseconds(60000));
       m_rtxInterest.push(interest);
@@ -553,17 +553,12 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
   else
     m_csFromNdnSim->Add(dataCopyWithoutTag);
 
-  ns3::Ptr<ns3::Node> n = ns3::NodeList::GetNode(0);
-  const nfd::Pit& p = n->GetObject<ns3::ndn::L3Protocol>()->getForwarder()->getPit();  
-  int cnt = 0; // num of sensitive packet
+  size_t cnt = 0; // num of sensitive packet
 
   if(!this->m_pit.getTransmit())
   {
-    for(auto it = p.begin(); it != p.end(); it++)
-    {
-      if( it->getName().toUri().find("root") != std::string::npos ) cnt++;
-    }
-    if( (cnt < 7) && (is_huge == 0) ) // data.getPitSize()
+    cnt = this->getNSensitivePending();
+    if( (cnt < SENSITIVE_BUSY_THRESHOLD) && (is_huge == 0) ) // data.getPitSize()
     {
       // if(!m_rtxInterest.empty())
       // {
@@ -607,30 +602,30 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
   // and send Data to all matched out faces
   else {
 
-    std::string content_name = data.getName().toUri();    
+    TrafficClass cls = Pit::getTrafficClass(*pitMatches.front());
 
     // Huge Data Incoming.
-    if ( (content_name.find("Huge") != std::string::npos) || (content_name.find("Mid") != std::string::npos) )
+    if ( isDeferrable(cls) )
     {
       // // If Network is busy. m_pit.size()
-      if ( cnt >= 7 )
+      if ( cnt >= SENSITIVE_BUSY_THRESHOLD )
       {
         if((is_mid == 0) && (is_huge == 1))
         {
           m_rtxData.push(data);
           return;
         }
-        else if( is_mid == 1 && is_huge == 1 && (content_name.find("Mid0") == std::string::npos) )
+        else if( is_mid == 1 && is_huge == 1 && (cls != TRAFFIC_CLASS_MID0) )
         {
           m_rtxData.push(data);
           return;
         }
-        else if( is_mid == 2 && is_huge == 1 && ((content_name.find("Mid2") != std::string::npos) || (content_name.find("Huge") != std::string::npos) ) )
+        else if( is_mid == 2 && is_huge == 1 && ((cls == TRAFFIC_CLASS_MID2) || (cls == TRAFFIC_CLASS_HUGE) ) )
         {
           m_rtxData.push(data);
           return;
         }
-        else if( is_mid == 3 && is_huge == 1 && (content_name.find("Huge") != std::string::npos) )
+        else if( is_mid == 3 && is_huge == 1 && (cls == TRAFFIC_CLASS_HUGE) )
         {
           m_rtxData.push(data);
           return;
@@ -684,7 +679,7 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
 
     }
 
-    if(!m_rtxData.empty() && ( cnt < 7 ) ) // m_pit
+    if(!m_rtxData.empty() && ( cnt < SENSITIVE_BUSY_THRESHOLD ) ) // m_pit
     {
       auto it = m_rtxData.front();
       int i = 0;
@@ -813,8 +808,7 @@ Forwarder::onIncomingNack(Face& inFace, const lp::Nack& nack)
   {
     // ns3::Ptr<ns3::Node> n = ns3::NodeList::GetNode(ns3::Simulator::GetContext());
     // const nfd::Pit& p = n->GetObject<ns3::ndn::L3Protocol>()->getForwarder()->getPit();    
-    std::string content_name = nack.getInterest().getName().toUri();
-    if( ((content_name.find("Huge") != std::string::npos) || (content_name.find("Mid") != std::string::npos)) && ( n->GetId() != 0 ) )
+    if( isDeferrable(Pit::getTrafficClass(*pitEntry)) && ( n->GetId() != 0 ) )
     {
       this->setExpiryTimer(pitEntry, ndn::time::milliseconds(60000)); // 60 seconds
       this->dontsend();
@@ -890,6 +884,15 @@ Forwarder::onDroppedInterest(Face& outFace, const Interest& interest)
   m_strategyChoice.findEffectiveStrategy(interest.getName()).onDroppedInterest(outFace, interest);
 }
 
+size_t
+Forwarder::getNSensitivePending() const
+{
+  if (m_congestionPit != nullptr) {
+    return m_congestionPit->getNSensitiveEntries();
+  }
+  return m_pit.getNSensitiveEntries();
+}
+
 void
 Forwarder::setExpiryTimer(const shared_ptr<pit::Entry>& pitEntry, time::milliseconds duration)
 {
@@ -38,6 +38,7 @@
 #include "table/strategy-choice.hpp"
 #include "table/dead-nonce-list.hpp"
 #include "table/network-region-table.hpp"
+#include "table/traffic-classifier.hpp"
 #include <queue>
 #include <map>
 #include <utility>
@@ -195,6 +196,26 @@ public: // forwarding entrypoints and tables
     return m_networkRegionTable;
   }
 
+  /** \brief classifier assigning a traffic class to each new PIT entry
+   */
+  TrafficClassifier&
+  getTrafficClassifier()
+  {
+    return m_trafficClassifier;
+  }
+
+  /** \brief gate deferred transmissions on the delay-sensitive entries of another PIT
+   *
+   *  By default, the forwarder considers the medium busy based on its own PIT.  Scenarios
+   *  where all nodes should react to the load seen by a single node (e.g., the access point)
+   *  can pass the PIT of that node; nullptr restores the default.
+   */
+  void
+  setCongestionPit(const Pit* pit)
+  {
+    m_congestionPit = pit;
+  }
+
 public: // allow enabling ndnSIM content store (will be removed in the future)
   void
   setCsFromNdnSim(ns3::Ptr<ns3::ndn::ContentStore> cs)
@@ -279,6 +300,13 @@ PROTECTED_WITH_TESTS_ELSE_PRIVATE:
   void
   setExpiryTimer(const shared_ptr<pit::Entry>& pitEntry, time::milliseconds duration);
 
+  /** \brief number of delay-sensitive entries in the PIT that gates deferred transmissions
+   *
+   *  The count is maintained by Pit on insert/erase, so this is O(1) per packet.
+   */
+  size_t
+  getNSensitivePending() const;
+
   /** \brief insert Nonce to Dead Nonce List if necessary
    *  \param upstream if null, insert Nonces from all out-records;
    *                  if not null, insert Nonce only on the out-records of this face
@@ -314,9 +342,14 @@ private:
   StrategyChoice     m_strategyChoice;
   DeadNonceList      m_deadNonceList;
   NetworkRegionTable m_networkRegionTable;
+  TrafficClassifier  m_trafficClassifier;
   shared_ptr<Face>   m_csFace;
   std::queue<Data>   m_rtxData;
   std::queue<Interest> m_rtxInterest;
+  /** \brief number of pending sensitive Interests at which the medium is considered busy
+   */
+  static const size_t SENSITIVE_BUSY_THRESHOLD = 7;
+  const Pit* m_congestionPit = nullptr; ///< if not null, used instead of m_pit for gating
   int is_huge = 0;
   int is_mid = 3;
   double lock;
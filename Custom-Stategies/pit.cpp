@@ -37,7 +37,9 @@ nteHasPitEntries(const name_tree::Entry& nte)
 Pit::Pit(NameTree& nameTree)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_classifier(nullptr)
 {
+  m_nItemsPerClass.fill(0);
 }
 
 std::pair<shared_ptr<Entry>, bool>
@@ -80,6 +82,12 @@ Pit::findOrInsert(const Interest& interest, bool allowInsert)
   auto entry = make_shared<Entry>(interest);
   nte->insertPitEntry(entry);
   ++m_nItems;
+
+  TrafficClass cls = TRAFFIC_CLASS_DEFAULT;
+  if (m_classifier != nullptr) {
+    cls = m_classifier->classify(entry->getInterest());
+  }
+  ++m_nItemsPerClass[cls];
   return {entry, true};
 }
 
@@ -105,6 +113,10 @@ Pit::erase(Entry* entry, bool canDeleteNte)
   name_tree::Entry* nte = m_nameTree.getEntry(*entry);
   BOOST_ASSERT(nte != nullptr);
 
+  TrafficClass cls = getTrafficClass(*entry);
+  BOOST_ASSERT(m_nItemsPerClass[cls] > 0);
+  --m_nItemsPerClass[cls];
+
   nte->erasePitEntry(entry);
   if (canDeleteNte) {
     m_nameTree.eraseIfEmpty(nte);
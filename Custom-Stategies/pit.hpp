@@ -28,6 +28,9 @@
 
 #include "pit-entry.hpp"
 #include "pit-iterator.hpp"
+#include "traffic-classifier.hpp"
+
+#include <array>
 
 namespace nfd {
 namespace pit {
@@ -93,6 +96,43 @@ public:
     this->erase(entry, true);
   }
 
+  /** \return number of entries of traffic class \p cls
+   */
+  size_t
+  size(TrafficClass cls) const
+  {
+    BOOST_ASSERT(cls < TRAFFIC_CLASS_MAX);
+    return m_nItemsPerClass[cls];
+  }
+
+  /** \return number of entries of the delay-sensitive traffic class
+   */
+  size_t
+  getNSensitiveEntries() const
+  {
+    return this->size(TRAFFIC_CLASS_SENSITIVE);
+  }
+
+  /** \brief sets the classifier applied to Interests of newly inserted entries
+   *
+   *  The traffic class is evaluated once when a PIT entry is inserted and cached on the entry's
+   *  Interest, so that per-class entry counts can be read without enumerating the PIT.
+   *  Entries inserted without a classifier belong to TRAFFIC_CLASS_DEFAULT.
+   */
+  void
+  setTrafficClassifier(const TrafficClassifier* classifier)
+  {
+    m_classifier = classifier;
+  }
+
+  /** \return traffic class of \p entry, determined when it was inserted
+   */
+  static TrafficClass
+  getTrafficClass(const Entry& entry)
+  {
+    return TrafficClassifier::getCachedClass(entry.getInterest());
+  }
+
   /** \brief deletes in-record and out-record for face
    */
   void
@@ -148,6 +188,8 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+  std::array<size_t, TRAFFIC_CLASS_MAX> m_nItemsPerClass;
+  const TrafficClassifier* m_classifier;
   bool canTransmit = true;
 };
 
@@ -0,0 +1,210 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "traffic-classifier.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+#include <algorithm>
+
+namespace nfd {
+
+static const std::string CFG_SECTION = "traffic_classes";
+
+std::ostream&
+operator<<(std::ostream& os, TrafficClass cls)
+{
+  switch (cls) {
+    case TRAFFIC_CLASS_DEFAULT:
+      return os << "default";
+    case TRAFFIC_CLASS_SENSITIVE:
+      return os << "sensitive";
+    case TRAFFIC_CLASS_MID0:
+      return os << "mid0";
+    case TRAFFIC_CLASS_MID1:
+      return os << "mid1";
+    case TRAFFIC_CLASS_MID2:
+      return os << "mid2";
+    case TRAFFIC_CLASS_HUGE:
+      return os << "huge";
+    case TRAFFIC_CLASS_MAX:
+      break;
+  }
+  return os << static_cast<int>(cls);
+}
+
+TrafficClassifier::TrafficClassifier()
+  : m_nameTree(32)
+{
+  this->installDefaultRules();
+}
+
+void
+TrafficClassifier::installDefaultRules()
+{
+  this->insertLabel("root", TRAFFIC_CLASS_SENSITIVE);
+  this->insertLabel("Mid0", TRAFFIC_CLASS_MID0);
+  this->insertLabel("Mid1", TRAFFIC_CLASS_MID1);
+  this->insertLabel("Mid2", TRAFFIC_CLASS_MID2);
+  this->insertLabel("Huge", TRAFFIC_CLASS_HUGE);
+}
+
+void
+TrafficClassifier::insert(const Name& prefix, TrafficClass cls)
+{
+  BOOST_ASSERT(cls < TRAFFIC_CLASS_MAX);
+  name_tree::Entry& nte = m_nameTree.lookup(prefix);
+  m_classes[&nte] = cls;
+}
+
+void
+TrafficClassifier::insertLabel(const std::string& label, TrafficClass cls)
+{
+  BOOST_ASSERT(cls < TRAFFIC_CLASS_MAX);
+  for (auto& rule : m_labels) {
+    if (rule.first == label) {
+      rule.second = cls;
+      return;
+    }
+  }
+  auto it = std::find_if(m_labels.begin(), m_labels.end(),
+                         [&label] (const std::pair<std::string, TrafficClass>& rule) {
+                           return rule.first.size() < label.size();
+                         });
+  m_labels.insert(it, {label, cls});
+}
+
+void
+TrafficClassifier::clear()
+{
+  // entries of m_nameTree are kept; without a rule they no longer match
+  m_classes.clear();
+  m_labels.clear();
+}
+
+TrafficClass
+TrafficClassifier::classify(const Name& name) const
+{
+  if (!m_classes.empty()) {
+    const name_tree::Entry* nte = m_nameTree.findLongestPrefixMatch(name,
+      [this] (const name_tree::Entry& entry) {
+        return m_classes.count(&entry) > 0;
+      });
+    if (nte != nullptr) {
+      return m_classes.at(nte);
+    }
+  }
+
+  if (name.empty()) {
+    return TRAFFIC_CLASS_DEFAULT;
+  }
+  const name::Component& first = name.get(0);
+  for (const auto& rule : m_labels) {
+    if (first.value_size() >= rule.first.size() &&
+        std::equal(rule.first.begin(), rule.first.end(), first.value_begin(),
+                   [] (char a, uint8_t b) { return static_cast<uint8_t>(a) == b; })) {
+      return rule.second;
+    }
+  }
+  return TRAFFIC_CLASS_DEFAULT;
+}
+
+TrafficClass
+TrafficClassifier::classify(const Interest& interest) const
+{
+  TrafficClass cls = this->classify(interest.getName());
+  interest.setTag(make_shared<TrafficClassTag>(cls));
+  return cls;
+}
+
+TrafficClass
+TrafficClassifier::getCachedClass(const Interest& interest)
+{
+  shared_ptr<TrafficClassTag> tag = interest.getTag<TrafficClassTag>();
+  if (tag == nullptr) {
+    return TRAFFIC_CLASS_DEFAULT;
+  }
+  return static_cast<TrafficClass>(tag->get());
+}
+
+TrafficClass
+TrafficClassifier::parseClass(const std::string& str)
+{
+  for (uint8_t i = 0; i < TRAFFIC_CLASS_MAX; ++i) {
+    TrafficClass cls = static_cast<TrafficClass>(i);
+    if (boost::lexical_cast<std::string>(cls) == str) {
+      return cls;
+    }
+  }
+  BOOST_THROW_EXCEPTION(ConfigFile::Error("Unknown traffic class \"" + str +
+                                          "\" in \"" + CFG_SECTION + "\" section"));
+}
+
+void
+TrafficClassifier::setConfigFile(ConfigFile& configFile)
+{
+  configFile.addSectionHandler(CFG_SECTION, bind(&TrafficClassifier::processConfig, this, _1, _2, _3));
+}
+
+void
+TrafficClassifier::processConfig(const ConfigSection& section, bool isDryRun, const std::string& filename)
+{
+  std::vector<std::pair<Name, TrafficClass>> rules;
+  std::vector<std::pair<std::string, TrafficClass>> labels;
+  for (const auto& item : section) {
+    TrafficClass cls = parseClass(item.second.get_value<std::string>());
+
+    const std::string& key = item.first;
+    if (key.size() > 2 && key.front() == '/' && key.back() == '*' &&
+        key.find('/', 1) == std::string::npos) {
+      labels.emplace_back(key.substr(1, key.size() - 2), cls);
+      continue;
+    }
+
+    Name prefix;
+    try {
+      prefix = Name(key);
+    }
+    catch (const Name::Error&) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid prefix \"" + key +
+                                              "\" in \"" + CFG_SECTION + "\" section"));
+    }
+    rules.emplace_back(prefix, cls);
+  }
+
+  if (isDryRun) {
+    return;
+  }
+
+  this->clear();
+  for (const auto& rule : rules) {
+    this->insert(rule.first, rule.second);
+  }
+  for (const auto& label : labels) {
+    this->insertLabel(label.first, label.second);
+  }
+}
+
+} // namespace nfd
@@ -0,0 +1,155 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_TRAFFIC_CLASSIFIER_HPP
+#define NFD_DAEMON_TABLE_TRAFFIC_CLASSIFIER_HPP
+
+#include "name-tree.hpp"
+#include "core/config-file.hpp"
+
+#include <ndn-cxx/tag.hpp>
+
+/** \brief defined when the forwarder has a TrafficClassifier, so ndnSIM can configure it
+ */
+#define NFD_HAVE_TRAFFIC_CLASSIFIER 1
+
+namespace nfd {
+
+/** \brief traffic class of an Interest, used to prioritize deferred transmissions
+ */
+enum TrafficClass : uint8_t {
+  TRAFFIC_CLASS_DEFAULT = 0, ///< no special treatment
+  TRAFFIC_CLASS_SENSITIVE,   ///< delay-sensitive traffic that signals a busy medium
+  TRAFFIC_CLASS_MID0,        ///< medium-size content, highest priority
+  TRAFFIC_CLASS_MID1,        ///< medium-size content
+  TRAFFIC_CLASS_MID2,        ///< medium-size content, lowest priority
+  TRAFFIC_CLASS_HUGE,        ///< huge content, deferred first when the medium is busy
+  TRAFFIC_CLASS_MAX
+};
+
+std::ostream&
+operator<<(std::ostream& os, TrafficClass cls);
+
+/** \brief caches the traffic class on an Interest
+ *
+ *  The classifier attaches this tag to the Interest stored in a PIT entry,
+ *  so the class is computed once per PIT entry.
+ */
+typedef ndn::SimpleTag<uint64_t, 0x60000010> TrafficClassTag;
+
+/** \brief maps Name prefixes to traffic classes
+ *
+ *  Two kinds of rules are supported:
+ *  - prefix rules, kept in a private NameTree and matched by longest prefix, component-wise;
+ *  - label rules, which match every name whose first component starts with the label.
+ *  Prefix rules take precedence over label rules, and a longer label takes precedence over a
+ *  shorter one.
+ *
+ *  By default, label rules for the naming convention of the wireless-wired scenarios are
+ *  installed: "root" is sensitive (e.g., /root/prefix and /root3), "Mid0", "Mid1" and "Mid2" are
+ *  medium of the given level (e.g., /Mid04), and "Huge" is huge (e.g., /Huge11).
+ *
+ *  Rules can be replaced through the \p traffic_classes config section, where a key ending with
+ *  '*' denotes a label rule:
+ *  \code
+ *  traffic_classes
+ *  {
+ *    /root*   sensitive
+ *    /Mid04   mid0
+ *    /video   huge
+ *  }
+ *  \endcode
+ */
+class TrafficClassifier : noncopyable
+{
+public:
+  TrafficClassifier();
+
+  /** \brief sets the traffic class of \p prefix and all names under it
+   */
+  void
+  insert(const Name& prefix, TrafficClass cls);
+
+  /** \brief sets the traffic class of names whose first component starts with \p label
+   */
+  void
+  insertLabel(const std::string& label, TrafficClass cls);
+
+  /** \brief removes all rules
+   */
+  void
+  clear();
+
+  /** \return number of rules
+   */
+  size_t
+  size() const
+  {
+    return m_classes.size() + m_labels.size();
+  }
+
+  /** \brief determines the traffic class of \p name by longest prefix match
+   */
+  TrafficClass
+  classify(const Name& name) const;
+
+  /** \brief classifies \p interest and caches the result on it
+   *  \return the traffic class
+   */
+  TrafficClass
+  classify(const Interest& interest) const;
+
+  /** \return traffic class cached on \p interest, or TRAFFIC_CLASS_DEFAULT if not classified
+   */
+  static TrafficClass
+  getCachedClass(const Interest& interest);
+
+  /** \brief parses a traffic class from its config file representation
+   *  \throw ConfigFile::Error unknown traffic class
+   */
+  static TrafficClass
+  parseClass(const std::string& str);
+
+  /** \brief registers the \p traffic_classes section handler
+   */
+  void
+  setConfigFile(ConfigFile& configFile);
+
+private:
+  void
+  processConfig(const ConfigSection& section, bool isDryRun, const std::string& filename);
+
+  void
+  installDefaultRules();
+
+private:
+  NameTree m_nameTree;
+  std::unordered_map<const name_tree::Entry*, TrafficClass> m_classes;
+  std::vector<std::pair<std::string, TrafficClass>> m_labels; ///< longest label first
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_TRAFFIC_CLASSIFIER_HPP
@@ -116,5 +116,16 @@ ConsumerCbr::GetRandomize() const
   return m_randomType;
 }
 
+int64_t
+ConsumerCbr::AssignStreams(int64_t stream)
+{
+  int64_t nStreams = Consumer::AssignStreams(stream);
+  if (m_random != 0) {
+    m_random->SetStream(stream + nStreams);
+    ++nStreams;
+  }
+  return nStreams;
+}
+
 } // namespace ndn
 } // namespace ns3
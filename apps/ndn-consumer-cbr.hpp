@@ -43,6 +43,9 @@ public:
   ConsumerCbr();
   virtual ~ConsumerCbr();
 
+  virtual int64_t
+  AssignStreams(int64_t stream);
+
 protected:
   /**
    * \brief Constructs the Interest packet and sends it using a callback to the underlying NDN
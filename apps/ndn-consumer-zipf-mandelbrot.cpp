@@ -23,6 +23,10 @@
 
 #include <math.h>
 
+#include <algorithm>
+#include <map>
+#include <tuple>
+
 NS_LOG_COMPONENT_DEFINE("ndn.ConsumerZipfMandelbrot");
 
 namespace ns3 {
@@ -70,24 +74,48 @@ ConsumerZipfMandelbrot::~ConsumerZipfMandelbrot()
 {
 }
 
-void
-ConsumerZipfMandelbrot::SetNumberOfContents(uint32_t numOfContents)
+/**
+ * @brief Get the table of cumulative probabilities for the given parameters
+ *
+ * Tables are shared between all consumers with the same (N, q, s) and freed when the last
+ * of them is destroyed
+ */
+static shared_ptr<const std::vector<double>>
+GetCumulativeProbabilities(uint32_t N, double q, double s)
 {
-  m_N = numOfContents;
+  static std::map<std::tuple<uint32_t, double, double>, std::weak_ptr<const std::vector<double>>>
+    tables;
 
-  NS_LOG_DEBUG(m_q << " and " << m_s << " and " << m_N);
+  std::weak_ptr<const std::vector<double>>& cached = tables[std::make_tuple(N, q, s)];
+  shared_ptr<const std::vector<double>> table = cached.lock();
+  if (table != nullptr) {
+    return table;
+  }
+
+  NS_LOG_DEBUG(q << " and " << s << " and " << N);
 
-  m_Pcum = std::vector<double>(m_N + 1);
+  auto Pcum = make_shared<std::vector<double>>(N + 1);
+  std::vector<double>& p = *Pcum;
 
-  m_Pcum[0] = 0.0;
-  for (uint32_t i = 1; i <= m_N; i++) {
-    m_Pcum[i] = m_Pcum[i - 1] + 1.0 / std::pow(i + m_q, m_s);
+  p[0] = 0.0;
+  for (uint32_t i = 1; i <= N; i++) {
+    p[i] = p[i - 1] + 1.0 / std::pow(i + q, s);
   }
 
-  for (uint32_t i = 1; i <= m_N; i++) {
-    m_Pcum[i] = m_Pcum[i] / m_Pcum[m_N];
-    NS_LOG_LOGIC("Cumulative probability [" << i << "]=" << m_Pcum[i]);
+  for (uint32_t i = 1; i <= N; i++) {
+    p[i] = p[i] / p[N];
+    NS_LOG_LOGIC("Cumulative probability [" << i << "]=" << p[i]);
   }
+
+  cached = Pcum;
+  return Pcum;
+}
+
+void
+ConsumerZipfMandelbrot::SetNumberOfContents(uint32_t numOfContents)
+{
+  m_N = numOfContents;
+  m_Pcum = nullptr; // rebuilt on the next request
 }
 
 uint32_t
@@ -100,7 +128,7 @@ void
 ConsumerZipfMandelbrot::SetQ(double q)
 {
   m_q = q;
-  SetNumberOfContents(m_N);
+  m_Pcum = nullptr; // rebuilt on the next request
 }
 
 double
@@ -113,7 +141,7 @@ void
 ConsumerZipfMandelbrot::SetS(double s)
 {
   m_s = s;
-  SetNumberOfContents(m_N);
+  m_Pcum = nullptr; // rebuilt on the next request
 }
 
 double
@@ -189,17 +217,30 @@ ConsumerZipfMandelbrot::SendPacket()
 
   m_rtt->SentSeq(SequenceNumber32(seq), 1);
 
+  ScheduleRetxCheck();
+
   m_transmittedInterests(interest, this, m_face);
   m_appLink->onReceiveInterest(*interest);
 
   ConsumerZipfMandelbrot::ScheduleNextPacket();
 }
 
+int64_t
+ConsumerZipfMandelbrot::AssignStreams(int64_t stream)
+{
+  int64_t nStreams = ConsumerCbr::AssignStreams(stream);
+  m_seqRng->SetStream(stream + nStreams);
+  return nStreams + 1;
+}
+
 uint32_t
 ConsumerZipfMandelbrot::GetNextSeq()
 {
+  if (m_Pcum == nullptr) {
+    m_Pcum = GetCumulativeProbabilities(m_N, m_q, m_s);
+  }
+
   uint32_t content_index = 1; //[1, m_N]
-  double p_sum = 0;
 
   double p_random = m_seqRng->GetValue();
   while (p_random == 0) {
@@ -207,15 +248,13 @@ ConsumerZipfMandelbrot::GetNextSeq()
   }
   // if (p_random == 0)
   NS_LOG_LOGIC("p_random=" << p_random);
-  for (uint32_t i = 1; i <= m_N; i++) {
-    p_sum = m_Pcum[i]; // m_Pcum[i] = m_Pcum[i-1] + p[i], p[0] = 0;   e.g.: p_cum[1] = p[1],
-                       // p_cum[2] = p[1] + p[2]
-    if (p_random <= p_sum) {
-      content_index = i;
-      break;
-    } // if
-  }   // for
-  // content_index = 1;
+
+  // m_Pcum[i] = m_Pcum[i-1] + p[i], p[0] = 0;   e.g.: p_cum[1] = p[1], p_cum[2] = p[1] + p[2]
+  // find the first i in [1, m_N] such that p_random <= m_Pcum[i]
+  auto it = std::lower_bound(m_Pcum->begin() + 1, m_Pcum->end(), p_random);
+  if (it != m_Pcum->end()) {
+    content_index = static_cast<uint32_t>(it - m_Pcum->begin());
+  }
   NS_LOG_DEBUG("RandomNumber=" << content_index);
   return content_index;
 }
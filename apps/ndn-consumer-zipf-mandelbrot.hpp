@@ -67,6 +67,9 @@ public:
   uint32_t
   GetNextSeq();
 
+  virtual int64_t
+  AssignStreams(int64_t stream);
+
 protected:
   virtual void
   ScheduleNextPacket();
@@ -94,7 +97,8 @@ private:
   uint32_t m_N;               // number of the contents
   double m_q;                 // q in (k+q)^s
   double m_s;                 // s in (k+q)^s
-  std::vector<double> m_Pcum; // cumulative probability
+  shared_ptr<const std::vector<double>> m_Pcum; // cumulative probability, shared between
+                                                // consumers with the same N, q, and s
 
   Ptr<UniformRandomVariable> m_seqRng; // RNG
 };
@@ -37,6 +37,8 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/ref.hpp>
 
+#include <algorithm>
+
 NS_LOG_COMPONENT_DEFINE("ndn.Consumer");
 
 namespace ns3 {
@@ -60,8 +62,9 @@ Consumer::GetTypeId(void)
                     MakeTimeAccessor(&Consumer::m_interestLifeTime), MakeTimeChecker())
 
       .AddAttribute("RetxTimer",
-                    "Timeout defining how frequent retransmission timeouts should be checked",
-                    StringValue("50ms"),
+                    "Minimum interval between two checks of retransmission timeouts (0 to check "
+                    "exactly when the earliest outstanding Interest times out)",
+                    StringValue("0ms"),
                     MakeTimeAccessor(&Consumer::GetRetxTimer, &Consumer::SetRetxTimer),
                     MakeTimeChecker())
 
@@ -92,13 +95,7 @@ void
 Consumer::SetRetxTimer(Time retxTimer)
 {
   m_retxTimer = retxTimer;
-  if (m_retxEvent.IsRunning()) {
-    // m_retxEvent.Cancel (); // cancel any scheduled cleanup events
-    Simulator::Remove(m_retxEvent); // slower, but better for memory
-  }
-
-  // schedule even with new timeout
-  m_retxEvent = Simulator::Schedule(m_retxTimer, &Consumer::CheckRetxTimeout, this);
+  ScheduleRetxCheck();
 }
 
 Time
@@ -128,7 +125,30 @@ Consumer::CheckRetxTimeout()
       break; // nothing else to do. All later packets need not be retransmitted
   }
 
-  m_retxEvent = Simulator::Schedule(m_retxTimer, &Consumer::CheckRetxTimeout, this);
+  m_lastRetxCheck = now;
+  ScheduleRetxCheck();
+}
+
+void
+Consumer::ScheduleRetxCheck()
+{
+  if (m_seqTimeouts.empty()) {
+    return; // nothing outstanding; a pending check, if any, will find nothing and not re-arm
+  }
+
+  Time now = Simulator::Now();
+  Time deadline = m_seqTimeouts.get<i_timestamp>().begin()->time + m_rtt->RetransmitTimeout();
+  deadline = std::max(deadline, m_lastRetxCheck + m_retxTimer);
+  deadline = std::max(deadline, now);
+
+  if (m_retxEvent.IsRunning()) {
+    if (now + Simulator::GetDelayLeft(m_retxEvent) <= deadline) {
+      return; // pending check is early enough and will re-arm itself for later deadlines
+    }
+    Simulator::Remove(m_retxEvent); // slower, but better for memory
+  }
+
+  m_retxEvent = Simulator::Schedule(deadline - now, &Consumer::CheckRetxTimeout, this);
 }
 
 // Application Methods
@@ -150,6 +170,7 @@ Consumer::StopApplication() // Called at time specified by Stop
 
   // cancel periodic packet generation
   Simulator::Cancel(m_sendEvent);
+  Simulator::Cancel(m_retxEvent);
 
   // cleanup base stuff
   App::StopApplication();
@@ -249,6 +270,9 @@ Consumer::OnData(shared_ptr<const Data> data)
   m_retxSeqs.erase(seq);
 
   m_rtt->AckSeq(SequenceNumber32(seq));
+
+  // RTO might have decreased
+  ScheduleRetxCheck();
 }
 
 void
@@ -275,6 +299,13 @@ Consumer::OnTimeout(uint32_t sequenceNumber)
   ScheduleNextPacket();
 }
 
+int64_t
+Consumer::AssignStreams(int64_t stream)
+{
+  m_rand->SetStream(stream);
+  return 1;
+}
+
 void
 Consumer::WillSendOutInterest(uint32_t sequenceNumber)
 {
@@ -290,6 +321,8 @@ Consumer::WillSendOutInterest(uint32_t sequenceNumber)
   m_seqRetxCounts[sequenceNumber]++;
 
   m_rtt->SentSeq(SequenceNumber32(sequenceNumber), 1);
+
+  ScheduleRetxCheck();
 }
 
 } // namespace ndn
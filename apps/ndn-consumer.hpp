@@ -92,6 +92,18 @@ public:
   virtual void
   WillSendOutInterest(uint32_t sequenceNumber);
 
+  /**
+   * @brief Assign fixed random variable stream numbers to the random variables of the app
+   *
+   * The random variables are reinitialized with the current seed and run number of
+   * RngSeedManager (e.g., to run replications of an already set up scenario).
+   *
+   * @param stream first stream index to use
+   * @return the number of stream indices assigned
+   */
+  virtual int64_t
+  AssignStreams(int64_t stream);
+
 public:
   typedef void (*LastRetransmittedInterestDataDelayCallback)(Ptr<App> app, uint32_t seqno, Time delay, int32_t hopCount);
   typedef void (*FirstInterestDataDelayCallback)(Ptr<App> app, uint32_t seqno, Time delay, uint32_t retxCount, int32_t hopCount);
@@ -118,15 +130,24 @@ protected:
   CheckRetxTimeout();
 
   /**
-   * \brief Modifies the frequency of checking the retransmission timeouts
-   * \param retxTimer Timeout defining how frequent retransmission timeouts should be checked
+   * \brief Schedules CheckRetxTimeout at the earliest retransmission deadline
+   *
+   * Should be called whenever an entry is added to m_seqTimeouts or RTO estimate decreases.
+   * Nothing is scheduled while there are no outstanding Interests.
+   */
+  void
+  ScheduleRetxCheck();
+
+  /**
+   * \brief Modifies the minimum interval between checks of the retransmission timeouts
+   * \param retxTimer Minimum interval between two checks (0 to check exactly at the deadlines)
    */
   void
   SetRetxTimer(Time retxTimer);
 
   /**
-   * \brief Returns the frequency of checking the retransmission timeouts
-   * \return Timeout defining how frequent retransmission timeouts should be checked
+   * \brief Returns the minimum interval between checks of the retransmission timeouts
+   * \return Minimum interval between two checks
    */
   Time
   GetRetxTimer() const;
@@ -137,8 +158,9 @@ protected:
   uint32_t m_seq;      ///< @brief currently requested sequence number
   uint32_t m_seqMax;   ///< @brief maximum number of sequence number
   EventId m_sendEvent; ///< @brief EventId of pending "send packet" event
-  Time m_retxTimer;    ///< @brief Currently estimated retransmission timer
-  EventId m_retxEvent; ///< @brief Event to check whether or not retransmission should be performed
+  Time m_retxTimer;     ///< @brief Minimum interval between retransmission checks
+  EventId m_retxEvent;  ///< @brief Event to check whether or not retransmission should be performed
+  Time m_lastRetxCheck; ///< @brief Time of the last retransmission check
 
   Ptr<RttEstimator> m_rtt; ///< @brief RTT estimator
 
@@ -0,0 +1,334 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-wireless-wired-sweep.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/wifi-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ndn-wireless-wired-sweep/parameter-sweep.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+namespace ns3 {
+
+/**
+ * Wireless/wired scenario for a sweep of parameters.
+ *
+ * Wired consumers (the nodes of the topology file whose names start with "p") request data
+ * through the wired routers and a Wi-Fi access point ("ap") from wireless producers, one producer
+ * per consumer.  Every consumer requests its own prefix with the given frequency and MaxSeq,
+ * except the first consumer, which requests /root0 ten times slower (delay-insensitive traffic).
+ *
+ * The runs are described by a sweep specification (see ParameterSweep), which can use the
+ * following parameters (default values in parentheses):
+ *
+ *  - topology: topology file, relative to --topologies (topo-wireless-wired1.txt)
+ *  - strategy: forwarding strategy, either a full name or a name under /localhost/nfd/strategy
+ *    (best-route)
+ *  - prefixes: "root" to request /root<i>, or "classified" to request the prefixes classified
+ *    by the custom strategy, i.e., /root0, /Huge1, /Mid22, /Mid13, /Mid04, /Huge5, ... (root)
+ *  - frequency: Interest frequency of the consumers (100)
+ *  - max-seq: MaxSeq of the consumers (12000)
+ *  - payload-size: PayloadSize of the producers (1024)
+ *  - cs-size: size of the LRU content store (1000)
+ *  - stop-time: simulation time in seconds (120)
+ *  - seed, run: seed and run number of the random number generator (1, 1)
+ *
+ * The included specification reproduces the former ndn-wireless-wired3.x (best-route) and
+ * ndn-wireless-wired4.x (custom-strategy) examples.  The runs are executed in parallel on all
+ * cores:
+ *
+ *     ./waf --run=ndn-wireless-wired-sweep --command-template="%s --output=wireless-wired"
+ *
+ * Each run writes application delay, L3 rate, and content store traces into its own
+ * directory (wireless-wired/run-<index>), and wireless-wired/summary.txt contains the
+ * parameters, the number of Interests and Data, and the average delay of every run.
+ */
+
+namespace {
+
+struct ConsumerStats {
+  void
+  OnInterest(shared_ptr<const ndn::Interest>, Ptr<ndn::App>, shared_ptr<ndn::Face>)
+  {
+    ++m_nInterests;
+  }
+
+  void
+  OnData(Ptr<ndn::App>, uint32_t, Time delay, int32_t)
+  {
+    ++m_nData;
+    m_totalDelay += delay.ToDouble(Time::S);
+  }
+
+  void
+  Connect(Ptr<Application> app)
+  {
+    app->TraceConnectWithoutContext("TransmittedInterests",
+                                    MakeCallback(&ConsumerStats::OnInterest, this));
+    app->TraceConnectWithoutContext("LastRetransmittedInterestDataDelay",
+                                    MakeCallback(&ConsumerStats::OnData, this));
+  }
+
+  void
+  AddResults(const std::string& group, ParameterSweep::Results& results) const
+  {
+    results.push_back({group + "Interests", std::to_string(m_nInterests)});
+    results.push_back({group + "Data", std::to_string(m_nData)});
+    results.push_back({group + "Delay", m_nData > 0 ? std::to_string(m_totalDelay / m_nData)
+                                                    : "NA"});
+  }
+
+  uint64_t m_nInterests = 0;
+  uint64_t m_nData = 0;
+  double m_totalDelay = 0;
+};
+
+std::string
+getPrefix(const std::string& prefixes, size_t index)
+{
+  if (prefixes != "root" && prefixes != "classified") {
+    throw ParameterSweep::Error("Unknown prefixes " + prefixes);
+  }
+  if (prefixes == "root" || index == 0) {
+    return "/root" + std::to_string(index);
+  }
+
+  switch (index % 4) {
+  case 1:
+    return "/Huge" + std::to_string(index);
+  case 2:
+    return "/Mid2" + std::to_string(index);
+  case 3:
+    return "/Mid1" + std::to_string(index);
+  default:
+    return "/Mid0" + std::to_string(index);
+  }
+}
+
+ParameterSweep::Results
+runScenario(const std::string& topologies, const ParameterSweep::Run& run,
+            const std::string& runDir)
+{
+  std::string phyMode("DsssRate1Mbps");
+  std::string dataMode("DsssRate11Mbps");
+
+  RngSeedManager::SetSeed(std::stoul(run.at("seed")));
+  RngSeedManager::SetRun(std::stoull(run.at("run")));
+
+  AnnotatedTopologyReader topologyReader("", 1);
+  topologyReader.SetFileName(topologies + "/" + run.at("topology"));
+  topologyReader.Read();
+
+  NodeContainer nodes = topologyReader.GetNodes();
+  std::vector<Ptr<Node>> consumers;
+  for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); ++node) {
+    if (Names::FindName(*node).compare(0, 1, "p") == 0) {
+      consumers.push_back(*node);
+    }
+  }
+  Ptr<Node> wifiApNode = Names::Find<Node>("ap");
+  if (consumers.empty() || wifiApNode == nullptr) {
+    throw ParameterSweep::Error("Topology " + run.at("topology")
+                                + " has no consumers or no ap node");
+  }
+
+  // disable fragmentation and RTS/CTS for frames below 2200 bytes
+  Config::SetDefault("ns3::WifiRemoteStationManager::FragmentationThreshold", StringValue("2200"));
+  Config::SetDefault("ns3::WifiRemoteStationManager::RtsCtsThreshold", StringValue("2200"));
+  // fix non-unicast data rate to be the same as that of unicast
+  Config::SetDefault("ns3::WifiRemoteStationManager::NonUnicastMode", StringValue(dataMode));
+
+  WifiHelper wifi;
+  wifi.SetStandard(WIFI_PHY_STANDARD_80211b);
+
+  YansWifiChannelHelper wifiChannel;
+  wifiChannel.SetPropagationDelay("ns3::ConstantSpeedPropagationDelayModel");
+  wifiChannel.AddPropagationLoss("ns3::ThreeLogDistancePropagationLossModel");
+  wifiChannel.AddPropagationLoss("ns3::NakagamiPropagationLossModel");
+
+  YansWifiPhyHelper wifiPhy = YansWifiPhyHelper::Default();
+  wifiPhy.SetPcapDataLinkType(YansWifiPhyHelper::DLT_IEEE802_11);
+  wifiPhy.Set("TxPowerStart", DoubleValue(5));
+  wifiPhy.Set("TxPowerEnd", DoubleValue(5));
+  wifiPhy.SetChannel(wifiChannel.Create());
+
+  NqosWifiMacHelper wifiMac = NqosWifiMacHelper::Default();
+  wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager", "DataMode", StringValue(dataMode),
+                               "ControlMode", StringValue(phyMode));
+
+  // one wireless producer per consumer
+  NodeContainer producers;
+  producers.Create(consumers.size());
+
+  wifiMac.SetType("ns3::StaWifiMac", "ActiveProbing", BooleanValue(false));
+  wifi.Install(wifiPhy, wifiMac, producers);
+  wifiMac.SetType("ns3::ApWifiMac");
+  wifi.Install(wifiPhy, wifiMac, wifiApNode);
+
+  MobilityHelper sessile;
+  Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
+  positionAlloc->Add(Vector(0, -20.0, 0.0));
+  sessile.SetPositionAllocator(positionAlloc);
+  sessile.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+  sessile.Install(wifiApNode);
+
+  // the first producer is in the middle, the others 2 m apart on both sides of it
+  MobilityHelper mobility;
+  Ptr<ListPositionAllocator> initialAlloc = CreateObject<ListPositionAllocator>();
+  initialAlloc->Add(Vector(0, 0, 0));
+  size_t nRight = consumers.size() / 2;
+  for (size_t i = nRight; i > 0; --i) {
+    initialAlloc->Add(Vector(2.0 * i, 0, 0));
+  }
+  for (size_t i = 1; i < consumers.size() - nRight; ++i) {
+    initialAlloc->Add(Vector(-2.0 * i, 0, 0));
+  }
+  mobility.SetPositionAllocator(initialAlloc);
+  mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+  mobility.Install(producers);
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.SetOldContentStore("ns3::ndn::cs::Lru", "MaxSize", run.at("cs-size"));
+  ndnHelper.InstallAll();
+
+  std::string strategy = run.at("strategy");
+  if (strategy.find('/') == std::string::npos) {
+    strategy = "/localhost/nfd/strategy/" + strategy;
+  }
+  ndn::StrategyChoiceHelper::InstallAll("/", strategy);
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+
+  uint32_t frequency = std::stoul(run.at("frequency"));
+  uint32_t maxSeq = std::stoul(run.at("max-seq"));
+
+  ndn::AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+  consumerHelper.SetAttribute("Randomize", StringValue("uniform"));
+
+  ndn::AppHelper producerHelper("ns3::ndn::Producer");
+  producerHelper.SetAttribute("PayloadSize", StringValue(run.at("payload-size")));
+
+  ConsumerStats insensitive;
+  ConsumerStats sensitive;
+  for (size_t i = 0; i < consumers.size(); ++i) {
+    std::string prefix = getPrefix(run.at("prefixes"), i);
+
+    // the first consumer requests delay-insensitive content
+    consumerHelper.SetAttribute("Frequency", DoubleValue(i == 0 ? frequency / 10.0 : frequency));
+    consumerHelper.SetAttribute("MaxSeq", IntegerValue(i == 0 ? maxSeq / 10 : maxSeq));
+    consumerHelper.SetPrefix(prefix);
+    (i == 0 ? insensitive : sensitive).Connect(consumerHelper.Install(consumers[i]).Get(0));
+
+    ndnGlobalRoutingHelper.AddOrigins(prefix, producers.Get(i));
+    producerHelper.SetPrefix(prefix);
+    producerHelper.Install(producers.Get(i));
+  }
+
+  ndn::GlobalRoutingHelper::CalculateRoutes();
+
+  ndn::AppDelayTracer::InstallAll(runDir + "/app-delays-trace.txt");
+  ndn::L3RateTracer::InstallAll(runDir + "/rate-trace.txt", Seconds(1.0));
+  ndn::CsTracer::InstallAll(runDir + "/cs-trace.txt", Seconds(1.0));
+
+  Simulator::Stop(Seconds(std::stod(run.at("stop-time"))));
+  Simulator::Run();
+
+  ndn::AppDelayTracer::Destroy();
+  ndn::L3RateTracer::Destroy();
+  ndn::CsTracer::Destroy();
+  Simulator::Destroy();
+
+  ParameterSweep::Results results;
+  insensitive.AddResults("Insensitive", results);
+  sensitive.AddResults("Sensitive", results);
+  return results;
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+  std::string sweepFile = "src/ndnSIM/examples/ndn-wireless-wired-sweep/wireless-wired.txt";
+  std::string topologies = "src/ndnSIM/examples/topologies";
+  std::string output = "wireless-wired";
+  uint32_t nJobs = std::max(std::thread::hardware_concurrency(), 1u);
+
+  CommandLine cmd;
+  cmd.AddValue("sweep", "Sweep specification", sweepFile);
+  cmd.AddValue("topologies", "Directory of the topology files", topologies);
+  cmd.AddValue("output", "Output directory for the traces and the summary", output);
+  cmd.AddValue("jobs", "Maximum number of runs executed in parallel", nJobs);
+  cmd.Parse(argc, argv);
+
+  ParameterSweep sweep;
+  sweep.AddParameter("topology", "topo-wireless-wired1.txt");
+  sweep.AddParameter("strategy", "best-route");
+  sweep.AddParameter("prefixes", "root");
+  sweep.AddParameter("frequency", "100");
+  sweep.AddParameter("max-seq", "12000");
+  sweep.AddParameter("payload-size", "1024");
+  sweep.AddParameter("cs-size", "1000");
+  sweep.AddParameter("stop-time", "120");
+  sweep.AddParameter("seed", "1");
+  sweep.AddParameter("run", "1");
+
+  std::ifstream is(sweepFile);
+  if (!is.is_open()) {
+    std::cerr << "Cannot open " << sweepFile << std::endl;
+    return 1;
+  }
+
+  try {
+    sweep.Load(is);
+    std::cout << "Executing " << sweep.GetRuns().size() << " runs, " << nJobs << " at a time"
+              << std::endl;
+
+    auto scenario = [&topologies] (const ParameterSweep::Run& run, const std::string& runDir) {
+      return runScenario(topologies, run, runDir);
+    };
+    size_t nFailed = sweep.Execute(scenario, output, nJobs);
+    if (nFailed > 0) {
+      std::cerr << nFailed << " runs failed, see log.txt in their directories" << std::endl;
+      return 1;
+    }
+  }
+  catch (const std::exception& e) {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::main(argc, argv);
+}
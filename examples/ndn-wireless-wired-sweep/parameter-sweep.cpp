@@ -0,0 +1,174 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "parameter-sweep.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+
+namespace ns3 {
+
+namespace {
+
+const char LOG_FILE[] = "log.txt";
+
+} // namespace
+
+void
+ParameterSweep::AddParameter(const std::string& name, const std::string& defaultValue)
+{
+  m_parameters.push_back({name, defaultValue});
+}
+
+void
+ParameterSweep::Load(std::istream& is)
+{
+  std::vector<std::pair<std::string, std::vector<std::string>>> section;
+  bool isInSection = false;
+
+  std::string line;
+  for (size_t lineNo = 1; std::getline(is, line); ++lineNo) {
+    std::istringstream tokens(line.substr(0, line.find('#')));
+    std::string name;
+    if (!(tokens >> name)) {
+      continue;
+    }
+
+    if (name == "sweep") {
+      if (isInSection) {
+        AddRuns(section);
+      }
+      section.clear();
+      isInSection = true;
+      continue;
+    }
+
+    std::string where = "line " + std::to_string(lineNo) + ": ";
+    if (!isInSection) {
+      throw Error(where + "parameter " + name + " is outside of a sweep section");
+    }
+    if (std::none_of(m_parameters.begin(), m_parameters.end(),
+                     [&name] (const std::pair<std::string, std::string>& parameter) {
+                       return parameter.first == name;
+                     })) {
+      throw Error(where + "unknown parameter " + name);
+    }
+    if (std::any_of(section.begin(), section.end(),
+                    [&name] (const std::pair<std::string, std::vector<std::string>>& values) {
+                      return values.first == name;
+                    })) {
+      throw Error(where + "parameter " + name + " is repeated in the section");
+    }
+
+    std::vector<std::string> values;
+    for (std::string value; tokens >> value;) {
+      values.push_back(value);
+    }
+    if (values.empty()) {
+      throw Error(where + "parameter " + name + " has no values");
+    }
+    section.push_back({name, values});
+  }
+
+  if (isInSection) {
+    AddRuns(section);
+  }
+}
+
+void
+ParameterSweep::AddRuns(const std::vector<std::pair<std::string,
+                                                    std::vector<std::string>>>& section)
+{
+  std::vector<Run> runs(1);
+  for (const auto& parameter : m_parameters) {
+    runs.front()[parameter.first] = parameter.second;
+  }
+
+  for (const auto& parameter : section) {
+    std::vector<Run> product;
+    for (const auto& run : runs) {
+      for (const auto& value : parameter.second) {
+        product.push_back(run);
+        product.back()[parameter.first] = value;
+      }
+    }
+    runs.swap(product);
+  }
+
+  m_runs.insert(m_runs.end(), runs.begin(), runs.end());
+}
+
+std::string
+ParameterSweep::GetRunDir(const std::string& outputDir, size_t index)
+{
+  return outputDir + "/run-" + std::to_string(index);
+}
+
+size_t
+ParameterSweep::Execute(const Scenario& scenario, const std::string& outputDir, size_t nJobs)
+{
+  for (size_t index = 0; index < m_runs.size(); ++index) {
+    WorkerProcesses::PrepareResultsDirectory(GetRunDir(outputDir, index));
+  }
+
+  auto runScenario = [&] (size_t index) {
+    std::string runDir = GetRunDir(outputDir, index);
+    WorkerProcesses::RedirectOutput(runDir + "/" + LOG_FILE);
+    WorkerProcesses::WriteResults(runDir, scenario(m_runs[index], runDir));
+  };
+
+  std::vector<WorkerProcesses::Status> statuses(m_runs.size());
+  std::vector<Results> results(m_runs.size());
+  size_t nFinished = 0;
+  auto onFinish = [&] (size_t index, const WorkerProcesses::Status& status) {
+    statuses[index] = status;
+    results[index] = WorkerProcesses::ReadResults(GetRunDir(outputDir, index));
+    std::cout << "[" << ++nFinished << "/" << m_runs.size() << "] run-" << index << " "
+              << status.description << " (" << status.wallTime << " s)" << std::endl;
+  };
+
+  size_t nFailed = WorkerProcesses::Run(m_runs.size(), nJobs, runScenario, onFinish);
+
+  WriteSummary(outputDir, statuses, results);
+  return nFailed;
+}
+
+void
+ParameterSweep::WriteSummary(const std::string& outputDir,
+                             const std::vector<WorkerProcesses::Status>& statuses,
+                             const std::vector<Results>& results) const
+{
+  std::vector<std::string> columns{"Run"};
+  for (const auto& parameter : m_parameters) {
+    columns.push_back(parameter.first);
+  }
+
+  std::vector<std::vector<std::string>> fields;
+  for (size_t index = 0; index < m_runs.size(); ++index) {
+    fields.push_back({"run-" + std::to_string(index)});
+    for (const auto& parameter : m_parameters) {
+      fields.back().push_back(m_runs[index].at(parameter.first));
+    }
+  }
+
+  WorkerProcesses::WriteSummary(outputDir + "/summary.txt", columns, fields, statuses, results);
+}
+
+} // namespace ns3
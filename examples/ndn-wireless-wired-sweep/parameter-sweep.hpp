@@ -0,0 +1,128 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_EXAMPLES_NDN_WIRELESS_WIRED_SWEEP_PARAMETER_SWEEP_HPP
+#define NDNSIM_EXAMPLES_NDN_WIRELESS_WIRED_SWEEP_PARAMETER_SWEEP_HPP
+
+#include "ns3/ndnSIM/utils/worker-processes.hpp"
+
+#include <functional>
+#include <istream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * @brief Runs a scenario for every combination of parameter values in separate processes
+ *
+ * The sweep specification consists of sections, each started by a line with the keyword
+ * @c sweep and followed by lines with a parameter name and one or more values:
+ *
+ *     # comment
+ *     sweep
+ *     topology   topo-wireless-wired1.txt topo-wireless-wired2.txt
+ *     frequency  50 100
+ *
+ * Every section adds the cartesian product of its values to the list of runs (4 runs in the
+ * example above), and parameters that are not listed in a section take their default values.
+ *
+ * Each run is executed in a forked worker process, so runs do not share any simulator state
+ * and up to the requested number of runs are executed in parallel.  The scenario of a run
+ * writes its traces into its own directory (<output>/run-<index>) and returns a set of named
+ * results, which are collected into a tab-separated summary table (<output>/summary.txt) with
+ * one row per run.
+ */
+class ParameterSweep {
+public:
+  class Error : public std::runtime_error {
+  public:
+    explicit Error(const std::string& what)
+      : std::runtime_error(what)
+    {
+    }
+  };
+
+  /**
+   * @brief Values of the parameters of one run, by parameter name
+   */
+  typedef std::map<std::string, std::string> Run;
+
+  /**
+   * @brief Named results of one run, in the order of the summary table columns
+   */
+  typedef std::vector<std::pair<std::string, std::string>> Results;
+
+  /**
+   * @brief Scenario that executes @p run, writes its traces into @p runDir, and returns the results
+   *
+   * The scenario is called in a worker process and may throw an exception to fail the run.
+   */
+  typedef std::function<Results(const Run& run, const std::string& runDir)> Scenario;
+
+  /**
+   * @brief Declare a parameter that can be used in the specification
+   */
+  void
+  AddParameter(const std::string& name, const std::string& defaultValue);
+
+  /**
+   * @brief Read the sweep specification and add its runs
+   * @throw Error the specification is malformed or uses an unknown parameter
+   */
+  void
+  Load(std::istream& is);
+
+  const std::vector<Run>&
+  GetRuns() const
+  {
+    return m_runs;
+  }
+
+  /**
+   * @brief Execute all runs, at most @p nJobs at a time, and write the summary table
+   *
+   * Standard output and error of each run are redirected to the log.txt file in its directory.
+   *
+   * @return number of failed runs
+   */
+  size_t
+  Execute(const Scenario& scenario, const std::string& outputDir, size_t nJobs);
+
+private:
+  void
+  AddRuns(const std::vector<std::pair<std::string, std::vector<std::string>>>& section);
+
+  void
+  WriteSummary(const std::string& outputDir, const std::vector<WorkerProcesses::Status>& statuses,
+               const std::vector<Results>& results) const;
+
+  static std::string
+  GetRunDir(const std::string& outputDir, size_t index);
+
+private:
+  std::vector<std::pair<std::string, std::string>> m_parameters; // name and default value
+  std::vector<Run> m_runs;
+};
+
+} // namespace ns3
+
+#endif // NDNSIM_EXAMPLES_NDN_WIRELESS_WIRED_SWEEP_PARAMETER_SWEEP_HPP
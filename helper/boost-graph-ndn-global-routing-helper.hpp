@@ -26,23 +26,33 @@
 
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/properties.hpp>
-#include <boost/ref.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/property_map/property_map.hpp>
 
 #include "ns3/ndnSIM/model/ndn-global-router.hpp"
 
 #include "ns3/node-list.h"
 #include "ns3/channel-list.h"
 
-#include <list>
-#include <map>
+#include <limits>
+#include <unordered_map>
+#include <vector>
 
 namespace boost {
 
+/**
+ * @brief Snapshot of GlobalRouter incidences in compressed sparse row form
+ *
+ * Vertices are GlobalRouters of all nodes followed by GlobalRouters of all channels, and are
+ * identified by dense indices.  Edges are identified by indices as well: out-edges of vertex u
+ * are [offset(u), offset(u + 1)), in the order of u's incidencies.  Face metrics are read when
+ * the snapshot is taken, so routing computations only touch flat arrays and can run
+ * concurrently on the same snapshot.
+ */
 class NdnGlobalRouterGraph {
 public:
-  typedef ns3::Ptr<ns3::ndn::GlobalRouter> Vertice;
-  typedef uint16_t edge_property_type;
-  typedef uint32_t vertex_property_type;
+  typedef uint32_t Vertex;
+  typedef uint32_t Edge;
 
   NdnGlobalRouterGraph()
   {
@@ -50,25 +60,144 @@ public:
          node++) {
       ns3::Ptr<ns3::ndn::GlobalRouter> gr = (*node)->GetObject<ns3::ndn::GlobalRouter>();
       if (gr != 0)
-        m_vertices.push_back(gr);
+        m_routers.push_back(gr);
     }
 
     for (ns3::ChannelList::Iterator channel = ns3::ChannelList::Begin();
          channel != ns3::ChannelList::End(); channel++) {
       ns3::Ptr<ns3::ndn::GlobalRouter> gr = (*channel)->GetObject<ns3::ndn::GlobalRouter>();
       if (gr != 0)
-        m_vertices.push_back(gr);
+        m_routers.push_back(gr);
+    }
+
+    for (Vertex vertex = 0; vertex < m_routers.size(); ++vertex) {
+      m_indices[ns3::PeekPointer(m_routers[vertex])] = vertex;
+    }
+
+    m_outOffsets.reserve(m_routers.size() + 1);
+    m_outOffsets.push_back(0);
+    for (Vertex vertex = 0; vertex < m_routers.size(); ++vertex) {
+      for (const auto& incidency : m_routers[vertex]->GetIncidencies()) {
+        const std::shared_ptr<nfd::Face>& face = std::get<1>(incidency);
+        m_sources.push_back(vertex);
+        m_targets.push_back(m_indices.at(ns3::PeekPointer(std::get<2>(incidency))));
+        m_faces.push_back(face.get());
+        m_metrics.push_back(face != nullptr ? static_cast<uint16_t>(face->getMetric()) : 0);
+      }
+      m_outOffsets.push_back(m_targets.size());
+    }
+
+    // in-edges, grouped by target (counting sort keeps them in the order of out-edges)
+    m_inOffsets.assign(m_routers.size() + 1, 0);
+    for (Vertex target : m_targets) {
+      ++m_inOffsets[target + 1];
+    }
+    for (Vertex vertex = 0; vertex < m_routers.size(); ++vertex) {
+      m_inOffsets[vertex + 1] += m_inOffsets[vertex];
+    }
+    m_inEdges.resize(m_targets.size());
+    std::vector<uint32_t> next(m_inOffsets.begin(), m_inOffsets.end() - 1);
+    for (Edge edge = 0; edge < m_targets.size(); ++edge) {
+      m_inEdges[next[m_targets[edge]]++] = edge;
     }
   }
 
-  const std::list<Vertice>&
-  GetVertices() const
+  size_t
+  GetNVertices() const
   {
-    return m_vertices;
+    return m_routers.size();
   }
 
-public:
-  std::list<Vertice> m_vertices;
+  const ns3::Ptr<ns3::ndn::GlobalRouter>&
+  GetRouter(Vertex vertex) const
+  {
+    return m_routers[vertex];
+  }
+
+  /**
+   * @brief Get index of the vertex of \p router, or null_vertex() if it is not in the snapshot
+   */
+  Vertex
+  FindVertex(const ns3::Ptr<ns3::ndn::GlobalRouter>& router) const
+  {
+    auto i = m_indices.find(ns3::PeekPointer(router));
+    if (i == m_indices.end())
+      return std::numeric_limits<Vertex>::max();
+    return i->second;
+  }
+
+  std::pair<Edge, Edge>
+  GetOutEdges(Vertex vertex) const
+  {
+    return std::make_pair(m_outOffsets[vertex], m_outOffsets[vertex + 1]);
+  }
+
+  std::pair<std::vector<Edge>::const_iterator, std::vector<Edge>::const_iterator>
+  GetInEdges(Vertex vertex) const
+  {
+    return std::make_pair(m_inEdges.begin() + m_inOffsets[vertex],
+                          m_inEdges.begin() + m_inOffsets[vertex + 1]);
+  }
+
+  Vertex
+  GetSource(Edge edge) const
+  {
+    return m_sources[edge];
+  }
+
+  Vertex
+  GetTarget(Edge edge) const
+  {
+    return m_targets[edge];
+  }
+
+  /**
+   * @brief Face through which the edge leaves its source (nullptr for edges leaving channels)
+   */
+  nfd::Face*
+  GetFace(Edge edge) const
+  {
+    return m_faces[edge];
+  }
+
+  /**
+   * @brief Routing metric of the edge's face at the time of the snapshot (0 if there is no face)
+   */
+  uint32_t
+  GetMetric(Edge edge) const
+  {
+    return m_metrics[edge];
+  }
+
+  const std::vector<uint32_t>&
+  GetMetrics() const
+  {
+    return m_metrics;
+  }
+
+  /**
+   * @brief Override routing metric of the edge (e.g., to take a failed link out of routing)
+   *
+   * Must not be called while routing computations on this graph are in progress.
+   */
+  void
+  SetMetric(Edge edge, uint32_t metric)
+  {
+    m_metrics[edge] = metric;
+  }
+
+private:
+  std::vector<ns3::Ptr<ns3::ndn::GlobalRouter>> m_routers;
+  std::unordered_map<ns3::ndn::GlobalRouter*, Vertex> m_indices;
+
+  std::vector<uint32_t> m_outOffsets;
+  std::vector<Vertex> m_sources;
+  std::vector<Vertex> m_targets;
+  std::vector<nfd::Face*> m_faces;
+  std::vector<uint32_t> m_metrics;
+
+  std::vector<uint32_t> m_inOffsets;
+  std::vector<Edge> m_inEdges;
 };
 
 class ndn_global_router_graph_category : public virtual vertex_list_graph_tag,
@@ -78,21 +207,27 @@ class ndn_global_router_graph_category : public virtual vertex_list_graph_tag,
 template<>
 struct graph_traits<NdnGlobalRouterGraph> {
   // Graph concept
-  typedef NdnGlobalRouterGraph::Vertice vertex_descriptor;
-  typedef ns3::ndn::GlobalRouter::Incidency edge_descriptor;
+  typedef NdnGlobalRouterGraph::Vertex vertex_descriptor;
+  typedef NdnGlobalRouterGraph::Edge edge_descriptor;
   typedef directed_tag directed_category;
-  typedef disallow_parallel_edge_tag edge_parallel_category;
+  typedef allow_parallel_edge_tag edge_parallel_category;
   typedef ndn_global_router_graph_category traversal_category;
 
   // VertexList concept
-  typedef std::list<vertex_descriptor>::const_iterator vertex_iterator;
+  typedef counting_iterator<vertex_descriptor> vertex_iterator;
   typedef size_t vertices_size_type;
 
   // AdjacencyGraph concept
-  typedef ns3::ndn::GlobalRouter::IncidencyList::iterator out_edge_iterator;
+  typedef counting_iterator<edge_descriptor> out_edge_iterator;
   typedef size_t degree_size_type;
 
-  // typedef size_t edges_size_type;
+  typedef size_t edges_size_type;
+
+  static vertex_descriptor
+  null_vertex()
+  {
+    return std::numeric_limits<vertex_descriptor>::max();
+  }
 };
 
 } // namespace boost
@@ -102,235 +237,75 @@ namespace boost {
 inline graph_traits<NdnGlobalRouterGraph>::vertex_descriptor
 source(graph_traits<NdnGlobalRouterGraph>::edge_descriptor e, const NdnGlobalRouterGraph& g)
 {
-  return std::get<0>(e);
+  return g.GetSource(e);
 }
 
 inline graph_traits<NdnGlobalRouterGraph>::vertex_descriptor
 target(graph_traits<NdnGlobalRouterGraph>::edge_descriptor e, const NdnGlobalRouterGraph& g)
 {
-  return std::get<2>(e);
+  return g.GetTarget(e);
 }
 
 inline std::pair<graph_traits<NdnGlobalRouterGraph>::vertex_iterator,
                  graph_traits<NdnGlobalRouterGraph>::vertex_iterator>
 vertices(const NdnGlobalRouterGraph& g)
 {
-  return make_pair(g.GetVertices().begin(), g.GetVertices().end());
+  typedef graph_traits<NdnGlobalRouterGraph>::vertex_iterator iterator;
+  return std::make_pair(iterator(0), iterator(g.GetNVertices()));
 }
 
 inline graph_traits<NdnGlobalRouterGraph>::vertices_size_type
 num_vertices(const NdnGlobalRouterGraph& g)
 {
-  return g.GetVertices().size();
+  return g.GetNVertices();
 }
 
 inline std::pair<graph_traits<NdnGlobalRouterGraph>::out_edge_iterator,
                  graph_traits<NdnGlobalRouterGraph>::out_edge_iterator>
 out_edges(graph_traits<NdnGlobalRouterGraph>::vertex_descriptor u, const NdnGlobalRouterGraph& g)
 {
-  return std::make_pair(u->GetIncidencies().begin(), u->GetIncidencies().end());
+  typedef graph_traits<NdnGlobalRouterGraph>::out_edge_iterator iterator;
+  std::pair<NdnGlobalRouterGraph::Edge, NdnGlobalRouterGraph::Edge> range = g.GetOutEdges(u);
+  return std::make_pair(iterator(range.first), iterator(range.second));
 }
 
 inline graph_traits<NdnGlobalRouterGraph>::degree_size_type
 out_degree(graph_traits<NdnGlobalRouterGraph>::vertex_descriptor u, const NdnGlobalRouterGraph& g)
 {
-  return u->GetIncidencies().size();
+  std::pair<NdnGlobalRouterGraph::Edge, NdnGlobalRouterGraph::Edge> range = g.GetOutEdges(u);
+  return range.second - range.first;
 }
 
 //////////////////////////////////////////////////////////////
 // Property maps
 
-struct EdgeWeights {
-  EdgeWeights(const NdnGlobalRouterGraph& graph)
-    : m_graph(graph)
-  {
-  }
-
-private:
-  const NdnGlobalRouterGraph& m_graph;
-};
-
-struct VertexIds {
-  VertexIds(const NdnGlobalRouterGraph& graph)
-    : m_graph(graph)
-  {
-  }
-
-private:
-  const NdnGlobalRouterGraph& m_graph;
-};
-
-template<>
-struct property_map<NdnGlobalRouterGraph, edge_weight_t> {
-  typedef const EdgeWeights const_type;
-  typedef EdgeWeights type;
-};
+typedef typed_identity_property_map<NdnGlobalRouterGraph::Vertex> NdnGlobalRouterVertexIndices;
+typedef iterator_property_map<std::vector<uint32_t>::const_iterator,
+                              typed_identity_property_map<NdnGlobalRouterGraph::Edge>, uint32_t,
+                              const uint32_t&> NdnGlobalRouterEdgeWeights;
 
 template<>
 struct property_map<NdnGlobalRouterGraph, vertex_index_t> {
-  typedef const VertexIds const_type;
-  typedef VertexIds type;
+  typedef NdnGlobalRouterVertexIndices type;
+  typedef NdnGlobalRouterVertexIndices const_type;
 };
 
 template<>
-struct property_traits<EdgeWeights> {
-  // Metric property map
-  typedef std::tuple<std::shared_ptr<nfd::Face>, uint16_t, double> value_type;
-  typedef std::tuple<std::shared_ptr<nfd::Face>, uint16_t, double> reference;
-  typedef ns3::ndn::GlobalRouter::Incidency key_type;
-  typedef readable_property_map_tag category;
-};
-
-const property_traits<EdgeWeights>::value_type WeightZero(nullptr, 0, 0.0);
-const property_traits<EdgeWeights>::value_type
-  WeightInf(nullptr, std::numeric_limits<uint16_t>::max(), 0.0);
-
-struct WeightCompare : public std::binary_function<property_traits<EdgeWeights>::reference,
-                                                   property_traits<EdgeWeights>::reference, bool> {
-  bool
-  operator()(std::tuple<std::shared_ptr<nfd::Face>, uint32_t, double> a,
-             std::tuple<std::shared_ptr<nfd::Face>, uint32_t, double> b) const
-  {
-    return std::get<1>(a) < std::get<1>(b);
-  }
-
-  bool
-  operator()(property_traits<EdgeWeights>::reference a, uint32_t b) const
-  {
-    return std::get<1>(a) < b;
-  }
-
-  bool
-  operator()(uint32_t a, uint32_t b) const
-  {
-    return a < b;
-  }
-};
-
-struct WeightCombine
-  : public std::binary_function<uint32_t, property_traits<EdgeWeights>::reference, uint32_t> {
-  uint32_t
-  operator()(uint32_t a, property_traits<EdgeWeights>::reference b) const
-  {
-    return a + std::get<1>(b);
-  }
-
-  std::tuple<std::shared_ptr<nfd::Face>, uint32_t, double>
-  operator()(std::tuple<std::shared_ptr<nfd::Face>, uint32_t, double> a,
-             property_traits<EdgeWeights>::reference b) const
-  {
-    if (std::get<0>(a) == nullptr)
-      return std::make_tuple(std::get<0>(b), std::get<1>(a) + std::get<1>(b),
-                             std::get<2>(a) + std::get<2>(b));
-    else
-      return std::make_tuple(std::get<0>(a), std::get<1>(a) + std::get<1>(b),
-                             std::get<2>(a) + std::get<2>(b));
-  }
-};
-
-template<>
-struct property_traits<VertexIds> {
-  // Metric property map
-  typedef uint32_t value_type;
-  typedef uint32_t reference;
-  typedef ns3::Ptr<ns3::ndn::GlobalRouter> key_type;
-  typedef readable_property_map_tag category;
+struct property_map<NdnGlobalRouterGraph, edge_weight_t> {
+  typedef NdnGlobalRouterEdgeWeights type;
+  typedef NdnGlobalRouterEdgeWeights const_type;
 };
 
-inline EdgeWeights
-get(edge_weight_t, const NdnGlobalRouterGraph& g)
-{
-  return EdgeWeights(g);
-}
-
-inline VertexIds
+inline NdnGlobalRouterVertexIndices
 get(vertex_index_t, const NdnGlobalRouterGraph& g)
 {
-  return VertexIds(g);
-}
-
-template<class M, class K, class V>
-inline void
-put(reference_wrapper<M> mapp, K a, V p)
-{
-  mapp.get()[a] = p;
+  return NdnGlobalRouterVertexIndices();
 }
 
-// void
-// put (cref< std::map< ns3::Ptr<ns3::ndn::GlobalRouter>, ns3::Ptr<ns3::ndn::GlobalRouter> > > map,
-
-inline uint32_t
-get(const boost::VertexIds&, ns3::Ptr<ns3::ndn::GlobalRouter>& gr)
-{
-  return gr->GetId();
-}
-
-inline property_traits<EdgeWeights>::reference
-get(const boost::EdgeWeights&, ns3::ndn::GlobalRouter::Incidency& edge)
-{
-  if (std::get<1>(edge) == 0)
-    return property_traits<EdgeWeights>::reference(nullptr, 0, 0.0);
-  else {
-    return property_traits<EdgeWeights>::reference(std::get<1>(edge),
-                                                   static_cast<uint16_t>(
-                                                     std::get<1>(edge)->getMetric()),
-                                                   0.0);
-  }
-}
-
-struct PredecessorsMap
-  : public std::map<ns3::Ptr<ns3::ndn::GlobalRouter>, ns3::Ptr<ns3::ndn::GlobalRouter>> {
-};
-
-template<>
-struct property_traits<reference_wrapper<PredecessorsMap>> {
-  // Metric property map
-  typedef ns3::Ptr<ns3::ndn::GlobalRouter> value_type;
-  typedef ns3::Ptr<ns3::ndn::GlobalRouter> reference;
-  typedef ns3::Ptr<ns3::ndn::GlobalRouter> key_type;
-  typedef read_write_property_map_tag category;
-};
-
-struct DistancesMap : public std::map<ns3::Ptr<ns3::ndn::GlobalRouter>,
-                                      std::tuple<std::shared_ptr<nfd::Face>, uint32_t, double>> {
-};
-
-template<>
-struct property_traits<reference_wrapper<DistancesMap>> {
-  // Metric property map
-  typedef std::tuple<std::shared_ptr<nfd::Face>, uint32_t, double> value_type;
-  typedef std::tuple<std::shared_ptr<nfd::Face>, uint32_t, double> reference;
-  typedef ns3::Ptr<ns3::ndn::GlobalRouter> key_type;
-  typedef read_write_property_map_tag category;
-};
-
-} // boost
-
-namespace std {
-template<>
-class numeric_limits<std::tuple<std::shared_ptr<nfd::Face>, uint32_t, double>>
-{
-public:
-  typedef std::tuple<std::shared_ptr<nfd::Face>, uint32_t, double> value;
-  static value
-  max()
-  {
-    return boost::WeightInf;
-  }
-};
-}
-
-namespace boost {
-
-inline std::tuple<std::shared_ptr<nfd::Face>, uint32_t, double>
-get(DistancesMap& map, ns3::Ptr<ns3::ndn::GlobalRouter> key)
+inline NdnGlobalRouterEdgeWeights
+get(edge_weight_t, const NdnGlobalRouterGraph& g)
 {
-  boost::DistancesMap::iterator i = map.find(key);
-  if (i == map.end())
-    return std::tuple<std::shared_ptr<nfd::Face>, uint32_t,
-                      double>(nullptr, std::numeric_limits<uint32_t>::max(), 0.0);
-  else
-    return i->second;
+  return NdnGlobalRouterEdgeWeights(g.GetMetrics().begin());
 }
 
 } // namespace boost
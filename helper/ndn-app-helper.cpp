@@ -23,6 +23,7 @@
 #include "ns3/names.h"
 
 #include "apps/ndn-app.hpp"
+#include "apps/ndn-consumer.hpp"
 
 #ifdef NS3_MPI
 #include "ns3/mpi-interface.h"
@@ -81,6 +82,22 @@ AppHelper::Install(NodeContainer c)
   return apps;
 }
 
+int64_t
+AppHelper::AssignStreams(NodeContainer c, int64_t stream)
+{
+  int64_t currentStream = stream;
+  for (NodeContainer::Iterator i = c.Begin(); i != c.End(); ++i) {
+    Ptr<Node> node = *i;
+    for (uint32_t j = 0; j < node->GetNApplications(); ++j) {
+      Ptr<Consumer> consumer = DynamicCast<Consumer>(node->GetApplication(j));
+      if (consumer != 0) {
+        currentStream += consumer->AssignStreams(currentStream);
+      }
+    }
+  }
+  return currentStream - stream;
+}
+
 Ptr<Application>
 AppHelper::InstallPriv(Ptr<Node> node)
 {
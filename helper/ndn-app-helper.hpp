@@ -91,6 +91,18 @@ public:
   ApplicationContainer
   Install(std::string nodeName);
 
+  /**
+   * @brief Assign fixed random variable stream numbers to the random variables of the
+   *        ns3::ndn::Consumer apps installed on the nodes of the container
+   *
+   * @param c NodeContainer of the set of nodes whose apps should be modified
+   * @param stream first stream index to use
+   * @return the number of stream indices assigned
+   * @sa Consumer::AssignStreams
+   */
+  static int64_t
+  AssignStreams(NodeContainer c, int64_t stream);
+
 private:
   /**
    * \internal
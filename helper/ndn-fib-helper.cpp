@@ -81,6 +81,51 @@ FibHelper::RemoveNextHop(const ControlParameters& parameters, Ptr<Node> node)
   l3protocol->injectInterest(*command);
 }
 
+void
+FibHelper::AddRoutes(Ptr<Node> node, const std::vector<Route>& routes)
+{
+  Ptr<L3Protocol> ndn = node->GetObject<L3Protocol>();
+  NS_ASSERT_MSG(ndn != 0, "Ndn stack should be installed on the node");
+
+  nfd::Fib& fib = ndn->getForwarder()->getFib();
+  nfd::fib::Entry* entry = nullptr;
+  for (const auto& route : routes) {
+    NS_LOG_LOGIC("[" << node->GetId() << "]$ route add " << route.prefix << " via "
+                     << route.face->getLocalUri() << " metric " << route.metric);
+    NS_ASSERT_MSG(ndn->getFaceById(route.face->getId()) == route.face,
+                  "Face [" << route.face->getId() << "] does not belong to node ["
+                           << node->GetId() << "]");
+
+    // routes are usually grouped by prefix, so avoid repeating the name tree lookup
+    if (entry == nullptr || entry->getPrefix() != route.prefix) {
+      entry = fib.insert(route.prefix).first;
+    }
+    entry->addNextHop(*route.face, route.metric);
+  }
+}
+
+void
+FibHelper::RemoveRoutes(Ptr<Node> node, const std::vector<Route>& routes)
+{
+  Ptr<L3Protocol> ndn = node->GetObject<L3Protocol>();
+  NS_ASSERT_MSG(ndn != 0, "Ndn stack should be installed on the node");
+
+  nfd::Fib& fib = ndn->getForwarder()->getFib();
+  for (const auto& route : routes) {
+    NS_LOG_LOGIC("[" << node->GetId() << "]$ route del " << route.prefix << " via "
+                     << route.face->getLocalUri());
+
+    nfd::fib::Entry* entry = fib.findExactMatch(route.prefix);
+    if (entry == nullptr)
+      continue;
+
+    entry->removeNextHop(*route.face);
+    if (!entry->hasNextHops()) {
+      fib.erase(*entry);
+    }
+  }
+}
+
 void
 FibHelper::AddRoute(Ptr<Node> node, const Name& prefix, shared_ptr<Face> face, int32_t metric)
 {
@@ -28,6 +28,8 @@
 
 #include <ndn-cxx/mgmt/nfd/control-parameters.hpp>
 
+#include <vector>
+
 namespace ns3 {
 namespace ndn {
 
@@ -40,9 +42,47 @@ using ::ndn::nfd::ControlParameters;
  * The FIB helper interacts with the FIB manager of NFD by sending special Interest
  * commands to the manager in order to add/remove a next hop from FIB entries or add
  * routes to the FIB manually (manual configuration of FIB).
+ *
+ * AddRoutes and RemoveRoutes bypass the FIB manager and modify the forwarder's FIB directly,
+ * which is what route computation helpers should use to populate FIBs before the simulation
+ * starts.
  */
 class FibHelper {
 public:
+  /**
+   * \brief Forwarding entry to be installed with AddRoutes
+   */
+  struct Route {
+    Name prefix;
+    shared_ptr<Face> face;
+    int32_t metric;
+  };
+
+  /**
+   * \brief Add a batch of forwarding entries directly to the FIB of the node
+   *
+   * Unlike AddRoute, no command Interests are created, signed, or processed by the FIB
+   * manager; next hops are inserted into nfd::Fib synchronously.  The result is the same as
+   * calling AddRoute for every element of \p routes.
+   *
+   * \param node   Node
+   * \param routes Forwarding entries (faces must belong to \p node)
+   */
+  static void
+  AddRoutes(Ptr<Node> node, const std::vector<Route>& routes);
+
+  /**
+   * \brief Remove a batch of forwarding entries directly from the FIB of the node
+   *
+   * Counterpart of AddRoutes; metrics of \p routes are ignored.  FIB entries that are left
+   * without next hops are removed.
+   *
+   * \param node   Node
+   * \param routes Forwarding entries (faces must belong to \p node)
+   */
+  static void
+  RemoveRoutes(Ptr<Node> node, const std::vector<Route>& routes);
+
   /**
    * \brief Add forwarding entry to FIB
    *
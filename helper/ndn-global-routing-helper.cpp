@@ -46,12 +46,19 @@
 #include "ns3/node-list.h"
 #include "ns3/channel-list.h"
 #include "ns3/object-factory.h"
+#include "ns3/simulator.h"
 
 #include <boost/lexical_cast.hpp>
 #include <boost/foreach.hpp>
 #include <boost/concept/assert.hpp>
 #include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/property_map/function_property_map.hpp>
 
+#include <atomic>
+#include <map>
+#include <memory>
+#include <queue>
+#include <thread>
 #include <unordered_map>
 
 #include "boost-graph-ndn-global-routing-helper.hpp"
@@ -63,6 +70,374 @@ NS_LOG_COMPONENT_DEFINE("ndn.GlobalRoutingHelper");
 namespace ns3 {
 namespace ndn {
 
+uint32_t GlobalRoutingHelper::m_nThreads = 0;
+bool GlobalRoutingHelper::m_isDynamicRouting = false;
+
+namespace {
+
+/**
+ * @brief Cost of a path: the face through which the path leaves the source and the sum of
+ *        routing metrics along the path
+ *
+ * Graph edges carry the face through which they leave their source vertex (if any), so
+ * combining costs preserves the first hop.
+ */
+struct PathCost {
+  nfd::Face* face;
+  uint32_t metric;
+};
+
+struct PathCostCompare {
+  bool
+  operator()(const PathCost& a, const PathCost& b) const
+  {
+    return a.metric < b.metric;
+  }
+};
+
+struct PathCostCombine {
+  PathCost
+  operator()(const PathCost& a, const PathCost& b) const
+  {
+    return {a.face != nullptr ? a.face : b.face, a.metric + b.metric};
+  }
+};
+
+const PathCost PATH_COST_ZERO = {nullptr, 0};
+const PathCost PATH_COST_INF = {nullptr, std::numeric_limits<uint16_t>::max()};
+
+/**
+ * @brief Cost of routes that CalculateAllPossibleRoutes does not install
+ *
+ * The per-face computation used to assign this metric to all other faces of the source, so
+ * routes that are at least this expensive were never reported through the face in question.
+ */
+const uint32_t DISABLED_ROUTE_METRIC = std::numeric_limits<uint16_t>::max() - 1;
+
+/**
+ * @brief Route to the local prefixes of a GlobalRouter
+ */
+struct Reachability {
+  uint32_t destination;
+  nfd::Face* face;
+  uint32_t metric;
+};
+
+/**
+ * @brief Shortest path distances (metrics only) and predecessors from one vertex
+ */
+struct ShortestPathTree {
+  std::vector<uint32_t> distances;
+  std::vector<uint32_t> predecessors;
+};
+
+/**
+ * @brief Weight map of boost::NdnGlobalRouterGraph that keeps track of the first hop
+ */
+struct EdgeCost {
+  typedef PathCost result_type;
+
+  PathCost
+  operator()(boost::NdnGlobalRouterGraph::Edge edge) const
+  {
+    return {graph->GetFace(edge), graph->GetMetric(edge)};
+  }
+
+  const boost::NdnGlobalRouterGraph* graph;
+};
+
+/**
+ * @brief Shortest path computations over a snapshot of the GlobalRouter graph
+ *
+ * Once constructed, the snapshot can be used concurrently from several threads, as shortest
+ * path computations touch neither ns3::Ptr (whose reference counts are not thread-safe) nor
+ * faces.
+ */
+class RouterGraphSnapshot {
+public:
+  typedef boost::NdnGlobalRouterGraph Graph;
+  typedef Graph::Vertex Vertex;
+
+  RouterGraphSnapshot()
+  {
+    BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept<Graph>));
+    BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept<Graph>));
+
+    for (Vertex vertex = 0; vertex < m_graph.GetNVertices(); ++vertex) {
+      if (!m_graph.GetRouter(vertex)->GetLocalPrefixes().empty()) {
+        m_origins.push_back(vertex);
+      }
+    }
+
+    // the order in which destinations were listed when distances were kept in a std::map
+    std::sort(m_origins.begin(), m_origins.end(), [this] (Vertex a, Vertex b) {
+        return m_graph.GetRouter(a) < m_graph.GetRouter(b);
+      });
+  }
+
+  size_t
+  getNVertices() const
+  {
+    return m_graph.GetNVertices();
+  }
+
+  const Ptr<GlobalRouter>&
+  getRouter(Vertex vertex) const
+  {
+    return m_graph.GetRouter(vertex);
+  }
+
+  const Graph&
+  getGraph() const
+  {
+    return m_graph;
+  }
+
+  void
+  setMetric(Graph::Edge edge, uint32_t metric)
+  {
+    m_graph.SetMetric(edge, metric);
+  }
+
+  /**
+   * @brief Find shortest paths from \p source to all GlobalRouters that export prefixes
+   * @param[out] tree if not nullptr, receives the shortest path tree of \p source
+   */
+  std::vector<Reachability>
+  getReachability(Vertex source, ShortestPathTree* tree = nullptr) const
+  {
+    std::vector<PathCost> distances(m_graph.GetNVertices());
+    std::vector<uint32_t> predecessors(m_graph.GetNVertices());
+    boost::dijkstra_shortest_paths(m_graph, source,
+                                   boost::weight_map(boost::make_function_property_map<Graph::Edge>(
+                                                       EdgeCost{&m_graph}))
+                                     .distance_map(boost::make_iterator_property_map(
+                                       distances.begin(), boost::get(boost::vertex_index, m_graph)))
+                                     .predecessor_map(boost::make_iterator_property_map(
+                                       predecessors.begin(), boost::get(boost::vertex_index, m_graph)))
+                                     .distance_inf(PATH_COST_INF)
+                                     .distance_zero(PATH_COST_ZERO)
+                                     .distance_compare(PathCostCompare())
+                                     .distance_combine(PathCostCombine()));
+
+    if (tree != nullptr) {
+      tree->distances.resize(distances.size());
+      for (size_t vertex = 0; vertex < distances.size(); ++vertex) {
+        tree->distances[vertex] = distances[vertex].metric;
+      }
+      tree->predecessors = std::move(predecessors);
+    }
+
+    std::vector<Reachability> reachability;
+    for (Vertex vertex : m_origins) {
+      if (vertex == source || distances[vertex].face == nullptr)
+        continue;
+
+      reachability.push_back({vertex, distances[vertex].face, distances[vertex].metric});
+    }
+    return reachability;
+  }
+
+  /**
+   * @brief Find shortest paths from \p source to all vertices
+   */
+  ShortestPathTree
+  getShortestPathTree(Vertex source) const
+  {
+    ShortestPathTree tree;
+    tree.distances.resize(m_graph.GetNVertices());
+    tree.predecessors.resize(m_graph.GetNVertices());
+    boost::dijkstra_shortest_paths(m_graph, source,
+                                   boost::weight_map(boost::get(boost::edge_weight, m_graph))
+                                     .distance_map(boost::make_iterator_property_map(
+                                       tree.distances.begin(), boost::get(boost::vertex_index, m_graph)))
+                                     .predecessor_map(boost::make_iterator_property_map(
+                                       tree.predecessors.begin(), boost::get(boost::vertex_index, m_graph)))
+                                     .distance_inf(PATH_COST_INF.metric));
+    return tree;
+  }
+
+  /**
+   * @brief Find, for every face of \p source, shortest paths to all GlobalRouters that export
+   *        prefixes among paths that leave \p source through this face
+   *
+   * A path that leaves through the face towards neighbor n costs the face metric plus the
+   * distance from n that avoids \p source.  The latter is taken from n's shortest path tree
+   * (\p trees must contain trees of all neighbors of \p source), and is recalculated only for
+   * the vertices whose shortest path from n goes through \p source.
+   *
+   * Reachabilities are grouped by face in the order of faces in the face table.
+   */
+  std::vector<Reachability>
+  getReachabilityPerFace(Vertex source, const std::vector<ShortestPathTree>& trees) const
+  {
+    std::vector<Reachability> reachability;
+    for (Graph::Edge edge : boost::make_iterator_range(boost::out_edges(source, m_graph))) {
+      nfd::Face* face = m_graph.GetFace(edge);
+      if (face == nullptr)
+        continue;
+
+      std::vector<uint32_t> distances = getDistancesAvoiding(trees[m_graph.GetTarget(edge)], source);
+      for (Vertex vertex : m_origins) {
+        if (vertex == source || distances[vertex] >= PATH_COST_INF.metric)
+          continue;
+
+        uint32_t metric = m_graph.GetMetric(edge) + distances[vertex];
+        if (metric >= DISABLED_ROUTE_METRIC)
+          continue;
+
+        reachability.push_back({vertex, face, metric});
+      }
+    }
+    return reachability;
+  }
+
+private:
+  /**
+   * @brief Get distances of \p tree in the graph without vertex \p excluded
+   */
+  std::vector<uint32_t>
+  getDistancesAvoiding(const ShortestPathTree& tree, Vertex excluded) const
+  {
+    const uint32_t inf = PATH_COST_INF.metric;
+    std::vector<uint32_t> distances = tree.distances;
+
+    // split vertices into those whose tree path goes through the excluded vertex and the rest
+    enum : uint8_t { UNKNOWN, KEPT, AFFECTED };
+    std::vector<uint8_t> state(m_graph.GetNVertices(), UNKNOWN);
+    state[excluded] = AFFECTED;
+    std::vector<Vertex> affected;
+    std::vector<Vertex> path;
+    for (Vertex vertex = 0; vertex < m_graph.GetNVertices(); ++vertex) {
+      Vertex ancestor = vertex;
+      while (state[ancestor] == UNKNOWN && distances[ancestor] < inf
+             && tree.predecessors[ancestor] != ancestor) {
+        path.push_back(ancestor);
+        ancestor = tree.predecessors[ancestor];
+      }
+      if (state[ancestor] == UNKNOWN) {
+        state[ancestor] = KEPT; // tree root or unreachable
+      }
+      for (Vertex descendant : path) {
+        state[descendant] = state[ancestor];
+        if (state[ancestor] == AFFECTED) {
+          affected.push_back(descendant);
+        }
+      }
+      path.clear();
+    }
+
+    // recalculate distances of affected vertices, starting from edges that enter them from kept
+    // vertices (whose distances do not change)
+    distances[excluded] = inf;
+    for (Vertex vertex : affected) {
+      distances[vertex] = inf;
+      for (Graph::Edge edge : boost::make_iterator_range(m_graph.GetInEdges(vertex))) {
+        Vertex source = m_graph.GetSource(edge);
+        if (state[source] == KEPT && distances[source] < inf) {
+          distances[vertex] = std::min(distances[vertex], distances[source] + m_graph.GetMetric(edge));
+        }
+      }
+    }
+
+    typedef std::pair<uint32_t, Vertex> QueueItem;
+    std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem>> queue;
+    for (Vertex vertex : affected) {
+      if (distances[vertex] < inf) {
+        queue.push({distances[vertex], vertex});
+      }
+    }
+    while (!queue.empty()) {
+      QueueItem item = queue.top();
+      queue.pop();
+      if (item.first != distances[item.second])
+        continue;
+
+      for (Graph::Edge edge : boost::make_iterator_range(boost::out_edges(item.second, m_graph))) {
+        Vertex target = m_graph.GetTarget(edge);
+        uint32_t distance = item.first + m_graph.GetMetric(edge);
+        if (target != excluded && state[target] == AFFECTED && distance < distances[target]) {
+          distances[target] = distance;
+          queue.push({distance, target});
+        }
+      }
+    }
+
+    return distances;
+  }
+
+private:
+  Graph m_graph;
+  std::vector<Vertex> m_origins;
+};
+
+/**
+ * @brief Routes calculated by the last CalculateRoutes
+ *
+ * Kept in the dynamic routing mode to repair routes when links change their state.
+ */
+struct RoutingState {
+  RouterGraphSnapshot snapshot;
+  std::vector<RouterGraphSnapshot::Vertex> sources;
+  std::vector<std::vector<Reachability>> reachabilities; ///< @brief per source
+  std::vector<ShortestPathTree> trees; ///< @brief per source
+  std::map<boost::NdnGlobalRouterGraph::Edge, uint32_t> downEdges; ///< @brief original metrics
+};
+
+std::unique_ptr<RoutingState> g_routingState;
+
+void
+clearRoutingState()
+{
+  g_routingState.reset();
+}
+
+/**
+ * @brief Get the FIB contents that correspond to \p reachabilities
+ *
+ * When several origins export the same prefix, the cost of the route installed last wins, as
+ * it does in FIB.
+ */
+std::map<std::pair<Name, nfd::Face*>, int32_t>
+getRoutes(const RouterGraphSnapshot& snapshot, const std::vector<Reachability>& reachabilities)
+{
+  std::map<std::pair<Name, nfd::Face*>, int32_t> routes;
+  for (const auto& reachability : reachabilities) {
+    for (const auto& prefix : snapshot.getRouter(reachability.destination)->GetLocalPrefixes()) {
+      routes[std::make_pair(*prefix, reachability.face)] = reachability.metric;
+    }
+  }
+  return routes;
+}
+
+/**
+ * @brief Call \p task for every index in [0, nTasks) using GlobalRoutingHelper threads
+ *
+ * The calling thread participates in the work; returns once all tasks are done.
+ */
+template<class Task>
+void
+runInParallel(size_t nTasks, const Task& task, uint32_t nThreads)
+{
+  std::atomic<size_t> nextTask(0);
+  auto worker = [&] {
+    for (size_t i = nextTask++; i < nTasks; i = nextTask++) {
+      task(i);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (uint32_t i = 1; i < std::min<size_t>(nThreads, nTasks); ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+} // namespace
+
 void
 GlobalRoutingHelper::Install(Ptr<Node> node)
 {
@@ -220,169 +595,231 @@ GlobalRoutingHelper::CalculateRoutes()
   /**
    * Implementation of route calculation is heavily based on Boost Graph Library
    * See http://www.boost.org/doc/libs/1_49_0/libs/graph/doc/table_of_contents.html for more details
+   *
+   * The graph is snapshotted once, Dijkstra is run for every source on a pool of worker threads,
+   * and the resulting routes are installed into FIBs by the calling thread.
    */
 
-  BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept<boost::NdnGlobalRouterGraph>));
-  BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept<boost::NdnGlobalRouterGraph>));
-
-  boost::NdnGlobalRouterGraph graph;
-  // typedef graph_traits < NdnGlobalRouterGraph >::vertex_descriptor vertex_descriptor;
+  std::unique_ptr<RoutingState> state(new RoutingState);
+  const RouterGraphSnapshot& snapshot = state->snapshot;
+  std::vector<RouterGraphSnapshot::Vertex>& sources = state->sources;
+  std::vector<std::vector<Reachability>>& reachabilities = state->reachabilities;
 
-  // For now we doing Dijkstra for every node.  Can be replaced with Bellman-Ford or Floyd-Warshall.
-  // Other algorithms should be faster, but they need additional EdgeListGraph concept provided by
-  // the graph, which
-  // is not obviously how implement in an efficient manner
-  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
-    Ptr<GlobalRouter> source = (*node)->GetObject<GlobalRouter>();
-    if (source == 0) {
-      NS_LOG_DEBUG("Node " << (*node)->GetId() << " does not export GlobalRouter interface");
-      continue;
+  for (size_t vertex = 0; vertex < snapshot.getNVertices(); ++vertex) {
+    if (snapshot.getRouter(vertex)->GetObject<Node>() != 0) {
+      sources.push_back(vertex);
     }
+  }
 
-    boost::DistancesMap distances;
-
-    dijkstra_shortest_paths(graph, source,
-                            // predecessor_map (boost::ref(predecessors))
-                            // .
-                            distance_map(boost::ref(distances))
-                              .distance_inf(boost::WeightInf)
-                              .distance_zero(boost::WeightZero)
-                              .distance_compare(boost::WeightCompare())
-                              .distance_combine(boost::WeightCombine()));
-
-    // NS_LOG_DEBUG (predecessors.size () << ", " << distances.size ());
-
-    Ptr<L3Protocol> L3protocol = (*node)->GetObject<L3Protocol>();
-    shared_ptr<nfd::Forwarder> forwarder = L3protocol->getForwarder();
-
-    NS_LOG_DEBUG("Reachability from Node: " << source->GetObject<Node>()->GetId());
-    for (const auto& dist : distances) {
-      if (dist.first == source)
-        continue;
-      else {
-        // cout << "  Node " << dist.first->GetObject<Node> ()->GetId ();
-        if (std::get<0>(dist.second) == 0) {
-          // cout << " is unreachable" << endl;
-        }
-        else {
-          for (const auto& prefix : dist.first->GetLocalPrefixes()) {
-            NS_LOG_DEBUG(" prefix " << prefix << " reachable via face " << *std::get<0>(dist.second)
-                         << " with distance " << std::get<1>(dist.second) << " with delay "
-                         << std::get<2>(dist.second));
-
-            FibHelper::AddRoute(*node, *prefix, std::get<0>(dist.second),
-                                std::get<1>(dist.second));
-          }
-        }
+  reachabilities.resize(sources.size());
+  if (m_isDynamicRouting) {
+    state->trees.resize(sources.size());
+  }
+  runInParallel(sources.size(), [&] (size_t i) {
+      reachabilities[i] = snapshot.getReachability(sources[i],
+                                                   m_isDynamicRouting ? &state->trees[i] : nullptr);
+    }, GetNumberOfThreads());
+
+  for (size_t i = 0; i < sources.size(); ++i) {
+    Ptr<Node> node = snapshot.getRouter(sources[i])->GetObject<Node>();
+
+    NS_LOG_DEBUG("Reachability from Node: " << node->GetId());
+    std::vector<FibHelper::Route> routes;
+    for (const auto& reachability : reachabilities[i]) {
+      shared_ptr<Face> face = reachability.face->shared_from_this();
+      for (const auto& prefix : snapshot.getRouter(reachability.destination)->GetLocalPrefixes()) {
+        NS_LOG_DEBUG(" prefix " << prefix << " reachable via face " << *face << " with distance "
+                     << reachability.metric);
+
+        routes.push_back({*prefix, face, static_cast<int32_t>(reachability.metric)});
       }
     }
+    FibHelper::AddRoutes(node, routes);
+  }
+
+  if (m_isDynamicRouting) {
+    if (g_routingState == nullptr) {
+      Simulator::ScheduleDestroy(&clearRoutingState);
+    }
+    g_routingState = std::move(state);
+  }
+  else {
+    g_routingState.reset();
   }
 }
 
 void
-GlobalRoutingHelper::CalculateAllPossibleRoutes()
+GlobalRoutingHelper::SetDynamicRouting(bool isEnabled)
 {
-  /**
-   * Implementation of route calculation is heavily based on Boost Graph Library
-   * See http://www.boost.org/doc/libs/1_49_0/libs/graph/doc/table_of_contents.html for more details
-   */
+  m_isDynamicRouting = isEnabled;
+  if (!isEnabled) {
+    g_routingState.reset();
+  }
+}
 
-  BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept<boost::NdnGlobalRouterGraph>));
-  BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept<boost::NdnGlobalRouterGraph>));
+void
+GlobalRoutingHelper::UpdateLinkState(Ptr<Node> node1, const Face& face1, Ptr<Node> node2,
+                                     const Face& face2, bool isUp)
+{
+  if (g_routingState == nullptr)
+    return;
 
-  boost::NdnGlobalRouterGraph graph;
-  // typedef graph_traits < NdnGlobalRouterGraph >::vertex_descriptor vertex_descriptor;
+  RoutingState& state = *g_routingState;
+  RouterGraphSnapshot& snapshot = state.snapshot;
+  const boost::NdnGlobalRouterGraph& graph = snapshot.getGraph();
 
-  // For now we doing Dijkstra for every node.  Can be replaced with Bellman-Ford or Floyd-Warshall.
-  // Other algorithms should be faster, but they need additional EdgeListGraph concept provided by
-  // the graph, which
-  // is not obviously how implement in an efficient manner
-  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
-    Ptr<GlobalRouter> source = (*node)->GetObject<GlobalRouter>();
-    if (source == 0) {
-      NS_LOG_DEBUG("Node " << (*node)->GetId() << " does not export GlobalRouter interface");
+  // take edges of the link out of routing, or restore their metrics
+  std::vector<boost::NdnGlobalRouterGraph::Edge> changedEdges;
+  for (const auto& side : {std::make_pair(node1, &face1), std::make_pair(node2, &face2)}) {
+    Ptr<GlobalRouter> gr = side.first->GetObject<GlobalRouter>();
+    if (gr == 0)
       continue;
+
+    auto vertex = graph.FindVertex(gr);
+    if (vertex == boost::graph_traits<boost::NdnGlobalRouterGraph>::null_vertex())
+      continue;
+
+    for (auto edge : boost::make_iterator_range(boost::out_edges(vertex, graph))) {
+      if (graph.GetFace(edge) != side.second)
+        continue;
+
+      auto downEdge = state.downEdges.find(edge);
+      if (!isUp && downEdge == state.downEdges.end()) {
+        state.downEdges.emplace(edge, graph.GetMetric(edge));
+        snapshot.setMetric(edge, PATH_COST_INF.metric);
+        changedEdges.push_back(edge);
+      }
+      else if (isUp && downEdge != state.downEdges.end()) {
+        snapshot.setMetric(edge, downEdge->second);
+        state.downEdges.erase(downEdge);
+        changedEdges.push_back(edge);
+      }
+    }
+  }
+
+  // only sources whose shortest path trees use a failed edge, or can be improved by a restored
+  // one, need to be recalculated
+  std::vector<size_t> affected;
+  for (size_t i = 0; i < state.sources.size(); ++i) {
+    const ShortestPathTree& tree = state.trees[i];
+    for (auto edge : changedEdges) {
+      auto source = graph.GetSource(edge);
+      auto target = graph.GetTarget(edge);
+      if (isUp ? tree.distances[source] + graph.GetMetric(edge) < tree.distances[target]
+               : tree.predecessors[target] == source && target != state.sources[i]) {
+        affected.push_back(i);
+        break;
+      }
     }
+  }
+
+  NS_LOG_DEBUG("Link " << node1->GetId() << " - " << node2->GetId() << " is "
+               << (isUp ? "up" : "down") << ", repairing routes of " << affected.size() << " of "
+               << state.sources.size() << " nodes");
 
-    Ptr<L3Protocol> L3protocol = (*node)->GetObject<L3Protocol>();
-    shared_ptr<nfd::Forwarder> forwarder = L3protocol->getForwarder();
+  std::vector<std::vector<Reachability>> reachabilities(affected.size());
+  runInParallel(affected.size(), [&] (size_t j) {
+      size_t i = affected[j];
+      reachabilities[j] = snapshot.getReachability(state.sources[i], &state.trees[i]);
+    }, GetNumberOfThreads());
 
-    NS_LOG_DEBUG("Reachability from Node: " << source->GetObject<Node>()->GetId() << " ("
-                                            << Names::FindName(source->GetObject<Node>()) << ")");
+  for (size_t j = 0; j < affected.size(); ++j) {
+    size_t i = affected[j];
+    Ptr<Node> node = snapshot.getRouter(state.sources[i])->GetObject<Node>();
 
-    Ptr<L3Protocol> l3 = source->GetObject<L3Protocol>();
-    NS_ASSERT(l3 != 0);
+    auto oldRoutes = getRoutes(snapshot, state.reachabilities[i]);
+    auto newRoutes = getRoutes(snapshot, reachabilities[j]);
 
-    // remember interface statuses
-    std::list<nfd::FaceId> faceIds;
-    std::unordered_map<nfd::FaceId, uint16_t> originalMetrics;
-    for (auto& nfdFace : l3->getForwarder()->getFaceTable()) {
-      faceIds.push_back(nfdFace.getId());
-      originalMetrics[nfdFace.getId()] = nfdFace.getMetric();
-      nfdFace.setMetric(std::numeric_limits<uint16_t>::max() - 1);
-      // value std::numeric_limits<uint16_t>::max () MUST NOT be used (reserved)
+    std::vector<FibHelper::Route> removedRoutes;
+    for (const auto& route : oldRoutes) {
+      if (newRoutes.count(route.first) == 0) {
+        removedRoutes.push_back({route.first.first, route.first.second->shared_from_this(),
+                                 route.second});
+      }
     }
 
-    for (auto& faceId : faceIds) {
-      auto* face = l3->getForwarder()->getFaceTable().get(faceId);
-      NS_ASSERT(face != nullptr);
-      auto transport = dynamic_cast<NetDeviceTransport*>(face->getTransport());
-      if (transport == nullptr) {
-        NS_LOG_DEBUG("Skipping non ndnSIM-specific transport face");
-        continue;
+    std::vector<FibHelper::Route> addedRoutes;
+    for (const auto& route : newRoutes) {
+      auto oldRoute = oldRoutes.find(route.first);
+      if (oldRoute == oldRoutes.end() || oldRoute->second != route.second) {
+        addedRoutes.push_back({route.first.first, route.first.second->shared_from_this(),
+                               route.second});
       }
+    }
 
-      // enabling only faceId
-      face->setMetric(originalMetrics[faceId]);
+    FibHelper::RemoveRoutes(node, removedRoutes);
+    FibHelper::AddRoutes(node, addedRoutes);
+    state.reachabilities[i] = std::move(reachabilities[j]);
+  }
+}
 
-      boost::DistancesMap distances;
+void
+GlobalRoutingHelper::SetNumberOfThreads(uint32_t nThreads)
+{
+  m_nThreads = nThreads;
+}
 
-      NS_LOG_DEBUG("-----------");
+uint32_t
+GlobalRoutingHelper::GetNumberOfThreads()
+{
+  if (m_nThreads != 0)
+    return m_nThreads;
 
-      dijkstra_shortest_paths(graph, source,
-                              // predecessor_map (boost::ref(predecessors))
-                              // .
-                              distance_map(boost::ref(distances))
-                                .distance_inf(boost::WeightInf)
-                                .distance_zero(boost::WeightZero)
-                                .distance_compare(boost::WeightCompare())
-                                .distance_combine(boost::WeightCombine()));
+  return std::max(std::thread::hardware_concurrency(), 1u);
+}
 
-      // NS_LOG_DEBUG (predecessors.size () << ", " << distances.size ());
+void
+GlobalRoutingHelper::CalculateAllPossibleRoutes()
+{
+  /**
+   * For every face of every node, install routes to all prefix origins along the shortest paths
+   * that leave the node through this face.
+   *
+   * Instead of running Dijkstra for every face with all other faces of the node disabled, the
+   * shortest path tree is calculated once for every vertex, and the cost of the best path
+   * through a face is derived from the tree of the neighbor behind the face (see
+   * RouterGraphSnapshot::getReachabilityPerFace).
+   */
 
-      for (const auto& dist : distances) {
-        if (dist.first == source)
-          continue;
-        else {
-          // cout << "  Node " << dist.first->GetObject<Node> ()->GetId ();
-          if (std::get<0>(dist.second) == 0) {
-            // cout << " is unreachable" << endl;
-          }
-          else {
-            for (const auto& prefix : dist.first->GetLocalPrefixes()) {
-              NS_LOG_DEBUG(" prefix " << *prefix << " reachable via face "
-                           << *std::get<0>(dist.second)
-                           << " with distance " << std::get<1>(dist.second)
-                           << " with delay " << std::get<2>(dist.second));
-
-              if (std::get<0>(dist.second)->getMetric() == std::numeric_limits<uint16_t>::max() - 1)
-                continue;
-
-              FibHelper::AddRoute(*node, *prefix, std::get<0>(dist.second),
-                                  std::get<1>(dist.second));
-            }
-          }
-        }
-      }
+  // routes installed by this method are not repaired in the dynamic routing mode
+  g_routingState.reset();
+
+  RouterGraphSnapshot snapshot;
+  size_t nVertices = snapshot.getNVertices();
 
-      // disabling the face again
-      face->setMetric(std::numeric_limits<uint16_t>::max() - 1);
+  std::vector<size_t> sources;
+  for (size_t vertex = 0; vertex < nVertices; ++vertex) {
+    if (snapshot.getRouter(vertex)->GetObject<Node>() != 0) {
+      sources.push_back(vertex);
     }
+  }
 
-    // recover original interface statuses
-    for (auto& i : originalMetrics) {
-      l3->getForwarder()->getFaceTable().get(i.first)->setMetric(i.second);
+  std::vector<ShortestPathTree> trees(nVertices);
+  runInParallel(nVertices, [&] (size_t vertex) {
+      trees[vertex] = snapshot.getShortestPathTree(vertex);
+    }, GetNumberOfThreads());
+
+  std::vector<std::vector<Reachability>> reachabilities(sources.size());
+  runInParallel(sources.size(), [&] (size_t i) {
+      reachabilities[i] = snapshot.getReachabilityPerFace(sources[i], trees);
+    }, GetNumberOfThreads());
+
+  for (size_t i = 0; i < sources.size(); ++i) {
+    Ptr<Node> node = snapshot.getRouter(sources[i])->GetObject<Node>();
+
+    NS_LOG_DEBUG("Reachability from Node: " << node->GetId() << " (" << Names::FindName(node)
+                                            << ")");
+    std::vector<FibHelper::Route> routes;
+    for (const auto& reachability : reachabilities[i]) {
+      shared_ptr<Face> face = reachability.face->shared_from_this();
+      for (const auto& prefix : snapshot.getRouter(reachability.destination)->GetLocalPrefixes()) {
+        NS_LOG_DEBUG(" prefix " << *prefix << " reachable via face " << *face << " with distance "
+                     << reachability.metric);
+
+        routes.push_back({*prefix, face, static_cast<int32_t>(reachability.metric)});
+      }
     }
+    FibHelper::AddRoutes(node, routes);
   }
 }
 
@@ -96,17 +96,65 @@ public:
 
   /**
    * @brief Calculate for every node shortest path trees and install routes to all prefix origins
+   *
+   * Shortest path trees are computed in parallel (see SetNumberOfThreads), while routes are
+   * installed into FIBs by the calling thread.
    */
   static void
   CalculateRoutes();
 
+  /**
+   * @brief Enable or disable the dynamic routing mode
+   *
+   * In the dynamic routing mode, CalculateRoutes keeps shortest path trees of all nodes (which
+   * needs memory for the distances between all pairs of nodes), and LinkControlHelper::FailLink
+   * and LinkControlHelper::UpLink repair routes of the affected nodes instead of leaving them
+   * pointing to the failed link.  Routes installed by CalculateAllPossibleRoutes are not
+   * repaired.
+   */
+  static void
+  SetDynamicRouting(bool isEnabled);
+
+  /**
+   * @brief Repair routes after a point-to-point link changed its state
+   *
+   * Does nothing unless routes were calculated by CalculateRoutes in the dynamic routing mode.
+   * Only the nodes whose shortest path trees are affected are recalculated, and only the routes
+   * that changed are updated in their FIBs.  Routes are the same as a full recalculation would
+   * produce, except for the choice among equal-cost paths.
+   *
+   * @param node1 one node
+   * @param face1 face of node1 on the link
+   * @param node2 another node
+   * @param face2 face of node2 on the link
+   * @param isUp  whether the link went up or down
+   */
+  static void
+  UpdateLinkState(Ptr<Node> node1, const Face& face1, Ptr<Node> node2, const Face& face2,
+                  bool isUp);
+
+  /**
+   * @brief Set number of threads used to calculate routes
+   * @param nThreads Number of threads; 0 (default) selects the number of hardware threads
+   */
+  static void
+  SetNumberOfThreads(uint32_t nThreads);
+
+  /**
+   * @brief Get number of threads that will be used to calculate routes
+   */
+  static uint32_t
+  GetNumberOfThreads();
+
   /**
    * @brief Calculate all possible next-hop independent alternative routes
    *
-   * Refer to the implementation for more details.
+   * For every face of every node, routes to all prefix origins are installed along the
+   * shortest paths that leave the node through this face.  Refer to the implementation for more
+   * details.
    *
-   * Note that this method is highly experimental and should be used with caution (very time
-   *consuming).
+   * Note that this method is highly experimental and should be used with caution.  It needs
+   * memory for the distances between all pairs of nodes.
    */
   static void
   CalculateAllPossibleRoutes();
@@ -114,6 +162,10 @@ public:
 private:
   void
   Install(Ptr<Channel> channel);
+
+private:
+  static uint32_t m_nThreads;
+  static bool m_isDynamicRouting;
 };
 
 } // namespace ndn
@@ -33,6 +33,7 @@
 
 #include "model/ndn-l3-protocol.hpp"
 #include "model/ndn-net-device-transport.hpp"
+#include "helper/ndn-global-routing-helper.hpp"
 #include "NFD/daemon/face/face.hpp"
 
 #include "fw/forwarder.hpp"
@@ -85,6 +86,10 @@ LinkControlHelper::setErrorRate(Ptr<Node> node1, Ptr<Node> node2, double errorRa
 
       nd1->SetAttribute("ReceiveErrorModel", PointerValue(errorFactory.Create<ErrorModel>()));
       nd2->SetAttribute("ReceiveErrorModel", PointerValue(errorFactory.Create<ErrorModel>()));
+
+      shared_ptr<Face> face2 = ndn2->getFaceByNetDevice(nd2);
+      NS_ASSERT(face2 != nullptr);
+      GlobalRoutingHelper::UpdateLinkState(node1, face, node2, *face2, errorRate < 1.0);
       return;
     }
   }
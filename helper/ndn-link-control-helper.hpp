@@ -43,6 +43,9 @@ public:
    *
    * Note that only PointToPointChannels are supported by this helper method
    *
+   * If routes were calculated in the dynamic routing mode (see
+   * GlobalRoutingHelper::SetDynamicRouting), routes of the affected nodes are repaired.
+   *
    * @param node1 one node
    * @param node2 another node
    */
@@ -73,6 +76,9 @@ public:
    *
    * Note that only PointToPointChannels are supported by this helper method
    *
+   * If routes were calculated in the dynamic routing mode (see
+   * GlobalRoutingHelper::SetDynamicRouting), routes of the affected nodes are repaired.
+   *
    * @param node1 one node
    * @param node2 another node
    */
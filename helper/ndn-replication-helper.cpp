@@ -0,0 +1,201 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-replication-helper.hpp"
+#include "ndn-app-helper.hpp"
+
+#include "utils/worker-processes.hpp"
+#include "utils/tracers/l2-rate-tracer.hpp"
+#include "utils/tracers/ndn-app-delay-tracer.hpp"
+#include "utils/tracers/ndn-cs-tracer.hpp"
+#include "utils/tracers/ndn-l3-rate-tracer.hpp"
+#include "utils/tracers/ndn-mem-tracer.hpp"
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/node-container.h"
+
+#include <ndn-cxx/util/random.hpp>
+
+#include <limits>
+
+NS_LOG_COMPONENT_DEFINE("ndn.ReplicationHelper");
+
+namespace ns3 {
+namespace ndn {
+
+namespace {
+
+const char LOG_FILE[] = "log.txt";
+
+} // namespace
+
+ReplicationHelper::ReplicationHelper()
+  : m_nReplications(1)
+  , m_firstRun(1)
+  , m_nJobs(1)
+  , m_outputDir("replications")
+  , m_stream(1000000)
+{
+}
+
+void
+ReplicationHelper::SetReplications(uint32_t nReplications, uint32_t firstRun/* = 1*/)
+{
+  m_nReplications = nReplications;
+  m_firstRun = firstRun;
+}
+
+void
+ReplicationHelper::SetJobs(size_t nJobs)
+{
+  m_nJobs = nJobs;
+}
+
+void
+ReplicationHelper::SetOutputDirectory(const std::string& outputDir)
+{
+  m_outputDir = outputDir;
+}
+
+void
+ReplicationHelper::SetStream(int64_t stream)
+{
+  m_stream = stream;
+}
+
+void
+ReplicationHelper::AddStreamAssigner(const StreamAssigner& assigner)
+{
+  m_assigners.push_back(assigner);
+}
+
+void
+ReplicationHelper::SetRunSetup(const RunSetup& setup)
+{
+  m_setup = setup;
+}
+
+void
+ReplicationHelper::SetResultCollector(const ResultCollector& collector)
+{
+  m_collector = collector;
+}
+
+std::string
+ReplicationHelper::GetRunDir(uint32_t run) const
+{
+  return m_outputDir + "/run-" + std::to_string(run);
+}
+
+void
+ReplicationHelper::RunReplication(uint32_t run, Time stopTime) const
+{
+  std::string runDir = GetRunDir(run);
+  WorkerProcesses::RedirectOutput(runDir + "/" + LOG_FILE);
+  NS_LOG_INFO("Replication with run number " << run);
+
+  // random variables of the setup were bound to the run number of the calling process
+  RngSeedManager::SetRun(run);
+  int64_t stream = m_stream;
+  stream += MobilityHelper::AssignStreams(NodeContainer::GetGlobal(), stream);
+  stream += AppHelper::AssignStreams(NodeContainer::GetGlobal(), stream);
+  for (const auto& assigner : m_assigners) {
+    stream += assigner(stream);
+  }
+
+  // nonces and the random choices of forwarding strategies
+  Ptr<UniformRandomVariable> seed = CreateObject<UniformRandomVariable>();
+  seed->SetStream(stream);
+  ::ndn::random::getRandomNumberEngine().seed(
+    seed->GetInteger(0, std::numeric_limits<uint32_t>::max()));
+
+  if (m_setup != nullptr) {
+    m_setup(run, runDir);
+  }
+
+  Simulator::Stop(stopTime);
+  Simulator::Run();
+
+  Results results;
+  if (m_collector != nullptr) {
+    results = m_collector(run);
+  }
+
+  // the worker exits without running static destructors, which would flush the traces
+  L2RateTracer::Destroy();
+  L3RateTracer::Destroy();
+  AppDelayTracer::Destroy();
+  CsTracer::Destroy();
+  MemTracer::Destroy();
+  Simulator::Destroy();
+
+  WorkerProcesses::WriteResults(runDir, results);
+}
+
+size_t
+ReplicationHelper::Run(Time stopTime)
+{
+  if (Simulator::Now() != Seconds(0)) {
+    throw Error("Replications must be started before the simulation");
+  }
+
+  for (uint32_t i = 0; i < m_nReplications; ++i) {
+    WorkerProcesses::PrepareResultsDirectory(GetRunDir(m_firstRun + i));
+  }
+
+  m_replications.clear();
+  m_replications.resize(m_nReplications);
+
+  auto runReplication = [this, stopTime] (size_t index) {
+    RunReplication(m_firstRun + index, stopTime);
+  };
+
+  std::vector<std::vector<std::string>> runs(m_nReplications);
+  std::vector<WorkerProcesses::Status> statuses(m_nReplications);
+  std::vector<Results> results(m_nReplications);
+  size_t nFinished = 0;
+  auto onFinish = [&] (size_t index, const WorkerProcesses::Status& status) {
+    Replication& replication = m_replications[index];
+    replication.run = m_firstRun + index;
+    replication.status = status.description;
+    replication.wallTime = status.wallTime;
+    if (status.isSuccessful) {
+      replication.results = WorkerProcesses::ReadResults(GetRunDir(replication.run));
+    }
+
+    runs[index] = {std::to_string(replication.run)};
+    statuses[index] = status;
+    results[index] = replication.results;
+
+    NS_LOG_INFO("[" << ++nFinished << "/" << m_nReplications << "] run-" << replication.run
+                << " " << status.description << " (" << status.wallTime << " s)");
+  };
+
+  size_t nFailed = WorkerProcesses::Run(m_nReplications, m_nJobs, runReplication, onFinish);
+
+  WorkerProcesses::WriteSummary(m_outputDir + "/summary.txt", {"Run"}, runs, statuses, results);
+  return nFailed;
+}
+
+} // namespace ndn
+} // namespace ns3
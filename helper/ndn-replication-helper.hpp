@@ -0,0 +1,203 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_HELPER_NDN_REPLICATION_HELPER_HPP
+#define NDNSIM_HELPER_NDN_REPLICATION_HELPER_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/nstime.h"
+
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Helper to run independent replications of a scenario that is set up only once
+ *
+ * The scenario (topology, NDN stacks, routes, and applications) is created in the calling
+ * process as usual.  Run then forks a worker process for each replication, which shares the
+ * setup with the calling process as copy-on-write memory, switches RngSeedManager to the run
+ * number of the replication, reinitializes the random variables, and runs the simulation.
+ * Results returned by the result collector of each replication are gathered by the calling
+ * process:
+ *
+ *     StackHelper ndnHelper;
+ *     ndnHelper.InstallAll();
+ *     ...
+ *     GlobalRoutingHelper::CalculateRoutes();
+ *     consumerHelper.Install(nodes.Get(0));
+ *
+ *     ReplicationHelper replications;
+ *     replications.SetReplications(10);
+ *     replications.SetJobs(4);
+ *     replications.SetRunSetup([] (uint32_t run, const std::string& runDir) {
+ *         AppDelayTracer::InstallAll(runDir + "/app-delays-trace.txt");
+ *       });
+ *     replications.SetResultCollector([] (uint32_t run) {
+ *         return ReplicationHelper::Results{{"Interests", std::to_string(...)}};
+ *       });
+ *     replications.Run(Seconds(20.0));
+ *
+ * Only the random variables that are known to the helper are reinitialized: mobility models,
+ * ns3::ndn::Consumer apps (see AppHelper::AssignStreams), the random number engine of NFD and
+ * ndn-cxx, and the ones of additional stream assigners (e.g., WifiHelper::AssignStreams).
+ * Replications are therefore reproducible for a given run number, but differ from the
+ * simulations of the same run number executed without the helper.
+ *
+ * Tracers and other objects that start threads or open files must be created in the run setup
+ * callback, i.e., in the worker process.
+ */
+class ReplicationHelper {
+public:
+  class Error : public std::runtime_error {
+  public:
+    explicit Error(const std::string& what)
+      : std::runtime_error(what)
+    {
+    }
+  };
+
+  /**
+   * @brief Named results of a replication
+   */
+  typedef std::vector<std::pair<std::string, std::string>> Results;
+
+  /**
+   * @brief Callback that assigns fixed random variable stream numbers starting from the
+   *        supplied one, and returns the number of stream indices assigned
+   */
+  typedef std::function<int64_t(int64_t stream)> StreamAssigner;
+
+  /**
+   * @brief Callback called in the worker process before the simulation of a replication
+   * @param run run number of the replication
+   * @param runDir directory for the output of the replication
+   */
+  typedef std::function<void(uint32_t run, const std::string& runDir)> RunSetup;
+
+  /**
+   * @brief Callback called in the worker process after the simulation of a replication
+   */
+  typedef std::function<Results(uint32_t run)> ResultCollector;
+
+  /**
+   * @brief Outcome of a replication, available after Run
+   */
+  struct Replication {
+    uint32_t run;
+    std::string status; ///< @brief "ok", "failed", or "killed(<signal number>)"
+    double wallTime;    ///< @brief seconds
+    Results results;    ///< @brief empty if the replication is not successful
+  };
+
+public:
+  ReplicationHelper();
+
+  /**
+   * @brief Set the number of replications and the run number of the first one
+   *
+   * Replication i uses run number @p firstRun + i.
+   */
+  void
+  SetReplications(uint32_t nReplications, uint32_t firstRun = 1);
+
+  /**
+   * @brief Set the maximum number of replications simulated at the same time
+   */
+  void
+  SetJobs(size_t nJobs);
+
+  /**
+   * @brief Set the directory, where run-<run number> subdirectories with log.txt and
+   *        results.txt of each replication, and summary.txt, are created
+   */
+  void
+  SetOutputDirectory(const std::string& outputDir);
+
+  /**
+   * @brief Set the first stream index assigned to the random variables
+   *
+   * Should be large enough not to collide with the stream indices that ns-3 assigns
+   * automatically.
+   */
+  void
+  SetStream(int64_t stream);
+
+  /**
+   * @brief Add a callback that reinitializes random variables unknown to the helper
+   */
+  void
+  AddStreamAssigner(const StreamAssigner& assigner);
+
+  void
+  SetRunSetup(const RunSetup& setup);
+
+  void
+  SetResultCollector(const ResultCollector& collector);
+
+  /**
+   * @brief Simulate all replications until @p stopTime and gather their results
+   *
+   * Must be called instead of Simulator::Run, before any event of the scenario is executed.
+   *
+   * @return number of replications that were not successful
+   * @throw Error Run is called after the simulation has started
+   * @throw WorkerProcesses::Error the output cannot be written or worker processes cannot be
+   *        started
+   */
+  size_t
+  Run(Time stopTime);
+
+  const std::vector<Replication>&
+  GetReplications() const
+  {
+    return m_replications;
+  }
+
+private:
+  std::string
+  GetRunDir(uint32_t run) const;
+
+  void
+  RunReplication(uint32_t run, Time stopTime) const;
+
+private:
+  uint32_t m_nReplications;
+  uint32_t m_firstRun;
+  size_t m_nJobs;
+  std::string m_outputDir;
+  int64_t m_stream;
+  std::vector<StreamAssigner> m_assigners;
+  RunSetup m_setup;
+  ResultCollector m_collector;
+
+  std::vector<Replication> m_replications;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_HELPER_NDN_REPLICATION_HELPER_HPP
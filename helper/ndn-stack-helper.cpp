@@ -50,8 +50,10 @@ StackHelper::StackHelper()
   // , m_isFaceManagerDisabled(false)
   , m_isForwarderStatusManagerDisabled(false)
   , m_isStrategyChoiceManagerDisabled(false)
+  , m_isLightweight(false)
   , m_needSetDefaultRoutes(false)
   , m_maxCsSize(100)
+  , m_addressingMode(NetDeviceTransport::AddressingMode::BROADCAST)
 {
   setCustomNdnCxxClocks();
 
@@ -87,6 +89,19 @@ StackHelper::setCustomNdnCxxClocks()
                                make_shared<ns3::ndn::time::CustomSystemClock>());
 }
 
+void
+StackHelper::setAddressingMode(NetDeviceTransport::AddressingMode mode)
+{
+  m_addressingMode = mode;
+}
+
+void
+StackHelper::addTrafficClass(const std::string& prefix, const std::string& trafficClass)
+{
+  m_trafficClasses.push_back({prefix, trafficClass});
+  m_nfdConfig = nullptr;
+}
+
 void
 StackHelper::SetDefaultRoutes(bool needSet)
 {
@@ -118,6 +133,7 @@ StackHelper::SetOldContentStore(const std::string& contentStore, const std::stri
                                 const std::string& value4)
 {
   m_maxCsSize = 0;
+  m_nfdConfig = nullptr;
 
   m_contentStoreFactory.SetTypeId(contentStore);
   if (attr1 != "")
@@ -134,6 +150,7 @@ void
 StackHelper::setCsSize(size_t maxSize)
 {
   m_maxCsSize = maxSize;
+  m_nfdConfig = nullptr;
 }
 
 void
@@ -181,23 +198,7 @@ StackHelper::Install(Ptr<Node> node) const
 
   Ptr<L3Protocol> ndn = m_ndnFactory.Create<L3Protocol>();
 
-  if (m_isRibManagerDisabled) {
-    ndn->getConfig().put("ndnSIM.disable_rib_manager", true);
-  }
-
-  // if (m_isFaceManagerDisabled) {
-  //   ndn->getConfig().put("ndnSIM.disable_face_manager", true);
-  // }
-
-  if (m_isForwarderStatusManagerDisabled) {
-    ndn->getConfig().put("ndnSIM.disable_forwarder_status_manager", true);
-  }
-
-  if (m_isStrategyChoiceManagerDisabled) {
-    ndn->getConfig().put("ndnSIM.disable_strategy_choice_manager", true);
-  }
-
-  ndn->getConfig().put("tables.cs_max_packets", (m_maxCsSize == 0) ? 1 : m_maxCsSize);
+  ndn->setConfig(getNfdConfig());
 
   // Create and aggregate content store if NFD's contest store has been disabled
   if (m_maxCsSize == 0) {
@@ -282,6 +283,7 @@ StackHelper::DefaultNetDeviceCallback(Ptr<Node> node, Ptr<L3Protocol> ndn,
   auto transport = make_unique<NetDeviceTransport>(node, netDevice,
                                                    constructFaceUri(netDevice),
                                                    "netdev://[ff:ff:ff:ff:ff:ff]");
+  transport->setAddressingMode(m_addressingMode);
 
   auto face = std::make_shared<Face>(std::move(linkService), std::move(transport));
   face->setMetric(1);
@@ -409,6 +411,7 @@ void
 StackHelper::disableRibManager()
 {
   m_isRibManagerDisabled = true;
+  m_nfdConfig = nullptr;
 }
 
 // void
@@ -421,12 +424,66 @@ void
 StackHelper::disableStrategyChoiceManager()
 {
   m_isStrategyChoiceManagerDisabled = true;
+  m_nfdConfig = nullptr;
 }
 
 void
 StackHelper::disableForwarderStatusManager()
 {
   m_isForwarderStatusManagerDisabled = true;
+  m_nfdConfig = nullptr;
+}
+
+void
+StackHelper::setLightweight(bool isLightweight)
+{
+  m_isLightweight = isLightweight;
+  m_nfdConfig = nullptr;
+}
+
+shared_ptr<const nfd::ConfigSection>
+StackHelper::getNfdConfig() const
+{
+  // prepared once and shared by all nodes installed with the same settings
+  if (m_nfdConfig != nullptr) {
+    return m_nfdConfig;
+  }
+
+  auto config = make_shared<nfd::ConfigSection>(*L3Protocol::getDefaultConfig());
+
+  if (m_isRibManagerDisabled) {
+    config->put("ndnSIM.disable_rib_manager", true);
+  }
+
+  // if (m_isFaceManagerDisabled) {
+  //   config->put("ndnSIM.disable_face_manager", true);
+  // }
+
+  if (m_isForwarderStatusManagerDisabled) {
+    config->put("ndnSIM.disable_forwarder_status_manager", true);
+  }
+
+  if (m_isStrategyChoiceManagerDisabled) {
+    config->put("ndnSIM.disable_strategy_choice_manager", true);
+    config->get_child("authorizations").get_child("authorize").get_child("privileges").erase("strategy-choice");
+  }
+
+  if (m_isLightweight) {
+    config->put("ndnSIM.lightweight", true);
+  }
+
+  config->put("tables.cs_max_packets", (m_maxCsSize == 0) ? 1 : m_maxCsSize);
+
+  if (!m_trafficClasses.empty()) {
+    nfd::ConfigSection trafficClasses;
+    for (const auto& rule : m_trafficClasses) {
+      trafficClasses.push_back({rule.first, nfd::ConfigSection(rule.second)});
+    }
+    config->put_child("traffic_classes", trafficClasses);
+  }
+
+  m_nfdConfig = config;
+  return m_nfdConfig;
 }
 
 void
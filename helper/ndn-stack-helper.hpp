@@ -31,6 +31,9 @@
 #include "ndn-fib-helper.hpp"
 #include "ndn-strategy-choice-helper.hpp"
 
+#include "ns3/ndnSIM/model/ndn-net-device-transport.hpp"
+#include "ns3/ndnSIM/model/ndn-l3-protocol.hpp"
+
 namespace nfd {
 namespace cs {
 class Policy;
@@ -248,6 +251,44 @@ public:
   void
   disableForwarderStatusManager();
 
+  /**
+   * @brief Enable or disable the lightweight node mode
+   *
+   * Lightweight nodes are created with only the forwarder and its tables.  NFD management
+   * (dispatcher, FIB, face, strategy choice, and forwarder status managers) is created on the
+   * first use, e.g., when FibHelper or StrategyChoiceHelper sends a command to the node, so
+   * nodes that are only configured through the FIB/strategy-choice tables or by
+   * GlobalRoutingHelper never pay for it.  The RIB manager is not created on lightweight nodes,
+   * so applications cannot register prefixes through ndn::Face::registerPrefix.
+   */
+  void
+  setLightweight(bool isLightweight = true);
+
+  /**
+   * @brief Set how faces created on non point-to-point NetDevices (Wi-Fi, CSMA, ...) address
+   *        outgoing packets
+   *
+   * By default (NetDeviceTransport::AddressingMode::BROADCAST), every packet is broadcast.
+   * With NetDeviceTransport::AddressingMode::LEARNED_PEER, Data and Nacks are unicast to the
+   * station that sent the Interest, and Interests to the station that recently returned Data
+   * for their prefix; see NetDeviceTransport::setAddressingMode.
+   */
+  void
+  setAddressingMode(NetDeviceTransport::AddressingMode mode);
+
+  /**
+   * @brief Add a rule to the traffic_classes section of the NFD config
+   *
+   * The section is used only by forwarders with a traffic classifier (see
+   * Custom-Stategies/traffic-classifier.hpp), and its rules replace the default ones.
+   *
+   * @param prefix name prefix, or "/<label>*" to match names whose first component starts with
+   *        the label
+   * @param trafficClass "default", "sensitive", "mid0", "mid1", "mid2", or "huge"
+   */
+  void
+  addTrafficClass(const std::string& prefix, const std::string& trafficClass);
+
   /**
    * @brief Set face metric of all faces connected through PointToPoint channel to channel latency
    */
@@ -268,6 +309,12 @@ private:
   // bool m_isFaceManagerDisabled;
   bool m_isForwarderStatusManagerDisabled;
   bool m_isStrategyChoiceManagerDisabled;
+  bool m_isLightweight;
+
+  shared_ptr<const nfd::ConfigSection>
+  getNfdConfig() const;
+
+  mutable shared_ptr<const nfd::ConfigSection> m_nfdConfig; // reset when settings change
 
 public:
   void
@@ -279,6 +326,8 @@ private:
 
   bool m_needSetDefaultRoutes;
   size_t m_maxCsSize;
+  NetDeviceTransport::AddressingMode m_addressingMode;
+  std::vector<std::pair<std::string, std::string>> m_trafficClasses;
 
   typedef std::function<std::unique_ptr<nfd::cs::Policy>()> PolicyCreationCallback;
   PolicyCreationCallback m_csPolicyCreationFunc;
@@ -32,6 +32,7 @@
 #include "ns3/string.h"
 
 #include "../../utils/trie/trie-with-policy.hpp"
+#include "../../utils/trie/pool-allocator.hpp"
 
 namespace ns3 {
 namespace ndn {
@@ -85,12 +86,12 @@ class ContentStoreImpl
       trie_with_policy<Name,
                        ndnSIM::smart_pointer_payload_traits<EntryImpl<ContentStoreImpl<Policy>>,
                                                             Entry>,
-                       Policy> {
+                       Policy, ndnSIM::pool_allocator_traits> {
 public:
   typedef ndnSIM::
     trie_with_policy<Name, ndnSIM::smart_pointer_payload_traits<EntryImpl<ContentStoreImpl<Policy>>,
                                                                 Entry>,
-                     Policy> super;
+                     Policy, ndnSIM::pool_allocator_traits> super;
 
   typedef EntryImpl<ContentStoreImpl<Policy>> entry;
 
@@ -102,8 +103,8 @@ public:
 
   // from ContentStore
 
-  virtual inline shared_ptr<Data>
-  Lookup(shared_ptr<const Interest> interest);
+  virtual inline shared_ptr<const Data>
+  LookupShared(shared_ptr<const Interest> interest);
 
   virtual inline bool
   Add(shared_ptr<const Data> data);
@@ -117,6 +118,9 @@ public:
   virtual uint32_t
   GetSize() const;
 
+  virtual MemoryUsage
+  GetMemoryUsage() const;
+
   virtual Ptr<Entry>
   Begin();
 
@@ -147,6 +151,12 @@ private:
   uint32_t
   GetMaxSize() const;
 
+  void
+  SetMaxBytes(uint64_t maxBytes);
+
+  uint64_t
+  GetMaxBytes() const;
+
 private:
   static LogComponent g_log; ///< @brief Logging variable
 
@@ -176,6 +186,12 @@ ContentStoreImpl<Policy>::GetTypeId()
                     StringValue("100"), MakeUintegerAccessor(&ContentStoreImpl<Policy>::GetMaxSize,
                                                              &ContentStoreImpl<Policy>::SetMaxSize),
                     MakeUintegerChecker<uint32_t>())
+      .AddAttribute("MaxBytes",
+                    "Set maximum total size (in bytes of Data wire encoding) of entries in "
+                    "ContentStore. If 0, limit is not enforced",
+                    StringValue("0"), MakeUintegerAccessor(&ContentStoreImpl<Policy>::GetMaxBytes,
+                                                           &ContentStoreImpl<Policy>::SetMaxBytes),
+                    MakeUintegerChecker<uint64_t>())
 
       .AddTraceSource("DidAddEntry",
                       "Trace fired every time entry is successfully added to the cache",
@@ -202,8 +218,8 @@ private:
 };
 
 template<class Policy>
-shared_ptr<Data>
-ContentStoreImpl<Policy>::Lookup(shared_ptr<const Interest> interest)
+shared_ptr<const Data>
+ContentStoreImpl<Policy>::LookupShared(shared_ptr<const Interest> interest)
 {
   NS_LOG_FUNCTION(this << interest->getName());
 
@@ -217,10 +233,9 @@ ContentStoreImpl<Policy>::Lookup(shared_ptr<const Interest> interest)
   }
 
   if (node != this->end()) {
-    this->m_cacheHitsTrace(interest, node->payload()->GetData());
-
-    shared_ptr<Data> copy = make_shared<Data>(*node->payload()->GetData());
-    return copy;
+    shared_ptr<const Data> data = node->payload()->GetData();
+    this->m_cacheHitsTrace(interest, data);
+    return data;
   }
   else {
     this->m_cacheMissesTrace(interest);
@@ -278,6 +293,20 @@ ContentStoreImpl<Policy>::GetMaxSize() const
   return this->getPolicy().get_max_size();
 }
 
+template<class Policy>
+void
+ContentStoreImpl<Policy>::SetMaxBytes(uint64_t maxBytes)
+{
+  this->getPolicy().set_max_bytes(maxBytes);
+}
+
+template<class Policy>
+uint64_t
+ContentStoreImpl<Policy>::GetMaxBytes() const
+{
+  return this->getPolicy().get_max_bytes();
+}
+
 template<class Policy>
 uint32_t
 ContentStoreImpl<Policy>::GetSize() const
@@ -285,6 +314,25 @@ ContentStoreImpl<Policy>::GetSize() const
   return this->getPolicy().size();
 }
 
+template<class Policy>
+ContentStore::MemoryUsage
+ContentStoreImpl<Policy>::GetMemoryUsage() const
+{
+  MemoryUsage usage{0, 0, 0};
+  std::tie(usage.nIndexNodes, usage.nIndexBytes) = super::get_memory_usage();
+
+  typename super::parent_trie::const_recursive_iterator item(super::getTrie()), end(0);
+  for (; item != end; item++) {
+    if (item->payload() == 0)
+      continue;
+
+    usage.nIndexBytes += sizeof(entry);
+    shared_ptr<const Data> data = item->payload()->GetData();
+    usage.nDataBytes += sizeof(Data) + (data->hasWire() ? data->wireEncode().size() : 0);
+  }
+  return usage;
+}
+
 template<class Policy>
 Ptr<Entry>
 ContentStoreImpl<Policy>::Begin()
@@ -49,8 +49,8 @@ Nocache::~Nocache()
 {
 }
 
-shared_ptr<Data>
-Nocache::Lookup(shared_ptr<const Interest> interest)
+shared_ptr<const Data>
+Nocache::LookupShared(shared_ptr<const Interest> interest)
 {
   this->m_cacheMissesTrace(interest);
   return 0;
@@ -52,8 +52,8 @@ public:
    */
   virtual ~Nocache();
 
-  virtual shared_ptr<Data>
-  Lookup(shared_ptr<const Interest> interest);
+  virtual shared_ptr<const Data>
+  LookupShared(shared_ptr<const Interest> interest);
 
   virtual bool
   Add(shared_ptr<const Data> data);
@@ -52,6 +52,22 @@ ContentStore::~ContentStore()
 {
 }
 
+shared_ptr<Data>
+ContentStore::Lookup(shared_ptr<const Interest> interest)
+{
+  shared_ptr<const Data> data = LookupShared(interest);
+  if (data == nullptr) {
+    return nullptr;
+  }
+  return make_shared<Data>(*data);
+}
+
+ContentStore::MemoryUsage
+ContentStore::GetMemoryUsage() const
+{
+  return MemoryUsage{0, 0, 0};
+}
+
 namespace cs {
 
 //////////////////////////////////////////////////////////////////////
@@ -95,7 +95,7 @@ private:
  * @ingroup ndn-cs
  * \brief Base class for NDN content store
  *
- * Particular implementations should implement Lookup, Add, and Print methods
+ * Particular implementations should implement LookupShared, Add, and Print methods
  */
 class ContentStore : public Object {
 public:
@@ -119,9 +119,24 @@ public:
    *
    * If an entry is found, it is promoted to the top of most recent
    * used entries index, \see m_contentStore
+   *
+   * \returns a copy of the cached Data, or nullptr if there is no match
+   *
+   * The default implementation copies the result of LookupShared.
    */
   virtual shared_ptr<Data>
-  Lookup(shared_ptr<const Interest> interest) = 0;
+  Lookup(shared_ptr<const Interest> interest);
+
+  /**
+   * \brief Find corresponding CS entry for the given interest, without copying it
+   *
+   * Same as Lookup, except that it avoids a deep copy of the Data on every hit.
+   *
+   * \returns the cached Data itself, or nullptr if there is no match.
+   *          The returned Data is shared with the content store and must not be modified.
+   */
+  virtual shared_ptr<const Data>
+  LookupShared(shared_ptr<const Interest> interest) = 0;
 
   /**
    * \brief Add a new content to the content store.
@@ -151,6 +166,23 @@ public:
   virtual uint32_t
   GetSize() const = 0;
 
+  /**
+   * @brief Estimated memory used by a content store
+   */
+  struct MemoryUsage {
+    uint64_t nIndexNodes; ///< @brief number of nodes of the index (e.g., trie nodes)
+    uint64_t nIndexBytes; ///< @brief bytes used by the index and cache entries
+    uint64_t nDataBytes;  ///< @brief bytes used by the cached Data packets
+  };
+
+  /**
+   * @brief Get estimated memory used by the content store
+   *
+   * The default implementation reports no memory
+   */
+  virtual MemoryUsage
+  GetMemoryUsage() const;
+
   /**
    * @brief Return first element of content store (no order guaranteed)
    */
@@ -208,10 +240,10 @@ ContentStore::GetContentStore(Ptr<Object> node)
 #include <boost/functional/hash.hpp>
 namespace boost {
 inline std::size_t
-hash_value(const ::ndn::name::Component component)
+hash_value(const ::ndn::name::Component& component)
 {
-  return boost::hash_range(component.wireEncode().wire(),
-                           component.wireEncode().wire() + component.wireEncode().size());
+  const ::ndn::Block& wire = component.wireEncode();
+  return boost::hash_range(wire.wire(), wire.wire() + wire.size());
 }
 }
 
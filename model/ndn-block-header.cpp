@@ -19,16 +19,11 @@
 
 #include "ndn-block-header.hpp"
 
-#include <iosfwd>
-#include <boost/iostreams/concepts.hpp>
-#include <boost/iostreams/stream.hpp>
-
 #include <ndn-cxx/encoding/tlv.hpp>
 #include <ndn-cxx/interest.hpp>
 #include <ndn-cxx/data.hpp>
 #include <ndn-cxx/lp/packet.hpp>
 
-namespace io = boost::iostreams;
 namespace nfdFace = nfd::face;
 
 namespace ns3 {
@@ -73,38 +68,70 @@ BlockHeader::Serialize(ns3::Buffer::Iterator start) const
   start.Write(m_block.wire(), m_block.size());
 }
 
-class Ns3BufferIteratorSource : public io::source {
-public:
-  Ns3BufferIteratorSource(ns3::Buffer::Iterator& is)
-    : m_is(is)
-  {
+namespace {
+
+/**
+ * @brief Read TLV-TYPE or TLV-LENGTH from the ns-3 buffer
+ * @param[out] number the decoded number
+ * @return false if the buffer ends before the number
+ */
+bool
+readVarNumber(ns3::Buffer::Iterator& i, uint64_t& number)
+{
+  if (i.GetRemainingSize() < 1) {
+    return false;
   }
 
-  std::streamsize
-  read(char* buf, std::streamsize nMaxRead)
-  {
-    std::streamsize i = 0;
-    for (; i < nMaxRead && !m_is.IsEnd(); ++i) {
-      buf[i] = m_is.ReadU8();
+  uint8_t firstOctet = i.ReadU8();
+  switch (firstOctet) {
+  case 253:
+    if (i.GetRemainingSize() < 2) {
+      return false;
     }
-    if (i == 0) {
-      return -1;
+    number = i.ReadNtohU16();
+    break;
+  case 254:
+    if (i.GetRemainingSize() < 4) {
+      return false;
     }
-    else {
-      return i;
+    number = i.ReadNtohU32();
+    break;
+  case 255:
+    if (i.GetRemainingSize() < 8) {
+      return false;
     }
+    number = i.ReadNtohU64();
+    break;
+  default:
+    number = firstOctet;
+    break;
   }
+  return true;
+}
 
-private:
-  ns3::Buffer::Iterator& m_is;
-};
+} // namespace
 
 uint32_t
 BlockHeader::Deserialize(ns3::Buffer::Iterator start)
 {
-  io::stream<Ns3BufferIteratorSource> is(start);
-  m_block = ::ndn::Block::fromStream(is);
-  return m_block.size();
+  // parse TLV-TYPE and TLV-LENGTH in place, then move the whole element with a single copy
+  // into the buffer that the Block will own
+  ns3::Buffer::Iterator i = start;
+  uint64_t type = 0;
+  uint64_t length = 0;
+  if (!readVarNumber(i, type) || !readVarNumber(i, length)) {
+    BOOST_THROW_EXCEPTION(::ndn::tlv::Error("Insufficient data during TLV parsing"));
+  }
+  if (length > i.GetRemainingSize()) {
+    BOOST_THROW_EXCEPTION(::ndn::tlv::Error("Not enough data in the buffer to fully parse TLV"));
+  }
+
+  uint32_t size = i.GetDistanceFrom(start) + length;
+  auto buffer = make_shared<::ndn::Buffer>(size);
+  start.Read(buffer->data(), size);
+
+  m_block = Block(std::move(buffer));
+  return size;
 }
 
 void
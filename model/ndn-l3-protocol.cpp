@@ -111,58 +111,8 @@ L3Protocol::GetTypeId(void)
 class L3Protocol::Impl {
 private:
   Impl()
+    : m_config(L3Protocol::getDefaultConfig())
   {
-    // Do not modify initial config file. Use helpers to set specific NFD parameters
-    std::string initialConfig =
-      "general\n"
-      "{\n"
-      "}\n"
-      "\n"
-      "tables\n"
-      "{\n"
-      "  cs_max_packets 100\n"
-      "\n"
-      "  strategy_choice\n"
-      "  {\n"
-      "    /               /localhost/nfd/strategy/best-route\n"
-      "    /localhost      /localhost/nfd/strategy/multicast\n"
-      "    /localhost/nfd  /localhost/nfd/strategy/best-route\n"
-      "    /ndn/multicast  /localhost/nfd/strategy/multicast\n"
-      "  }\n"
-      "}\n"
-      "\n"
-      // "face_system\n"
-      // "{\n"
-      // "}\n"
-      "\n"
-      "authorizations\n"
-      "{\n"
-      "  authorize\n"
-      "  {\n"
-      "    certfile any\n"
-      "    privileges\n"
-      "    {\n"
-      "      faces\n"
-      "      fib\n"
-      "      strategy-choice\n"
-      "    }\n"
-      "  }\n"
-      "}\n"
-      "\n"
-      "rib\n"
-      "{\n"
-      "  localhost_security\n"
-      "  {\n"
-      "    trust-anchor\n"
-      "    {\n"
-      "      type any\n"
-      "    }\n"
-      "  }\n"
-      "}\n"
-      "\n";
-
-    std::istringstream input(initialConfig);
-    boost::property_tree::read_info(input, m_config);
   }
 
   friend class L3Protocol;
@@ -186,12 +136,75 @@ private:
 
   std::shared_ptr<nfd::face::FaceSystem> m_faceSystem;
 
-  nfd::ConfigSection m_config;
+  // may be shared with other nodes; m_ownConfig is set once the node's config has been copied
+  shared_ptr<const nfd::ConfigSection> m_config;
+  shared_ptr<nfd::ConfigSection> m_ownConfig;
 
   Ptr<ContentStore> m_csFromNdnSim;
   PolicyCreationCallback m_policy;
 };
 
+shared_ptr<const nfd::ConfigSection>
+L3Protocol::getDefaultConfig()
+{
+  static shared_ptr<const nfd::ConfigSection> config = [] {
+      // Do not modify initial config file. Use helpers to set specific NFD parameters
+      std::string initialConfig =
+        "general\n"
+        "{\n"
+        "}\n"
+        "\n"
+        "tables\n"
+        "{\n"
+        "  cs_max_packets 100\n"
+        "\n"
+        "  strategy_choice\n"
+        "  {\n"
+        "    /               /localhost/nfd/strategy/best-route\n"
+        "    /localhost      /localhost/nfd/strategy/multicast\n"
+        "    /localhost/nfd  /localhost/nfd/strategy/best-route\n"
+        "    /ndn/multicast  /localhost/nfd/strategy/multicast\n"
+        "  }\n"
+        "}\n"
+        "\n"
+        // "face_system\n"
+        // "{\n"
+        // "}\n"
+        "\n"
+        "authorizations\n"
+        "{\n"
+        "  authorize\n"
+        "  {\n"
+        "    certfile any\n"
+        "    privileges\n"
+        "    {\n"
+        "      faces\n"
+        "      fib\n"
+        "      strategy-choice\n"
+        "    }\n"
+        "  }\n"
+        "}\n"
+        "\n"
+        "rib\n"
+        "{\n"
+        "  localhost_security\n"
+        "  {\n"
+        "    trust-anchor\n"
+        "    {\n"
+        "      type any\n"
+        "    }\n"
+        "  }\n"
+        "}\n"
+        "\n";
+
+      auto config = make_shared<nfd::ConfigSection>();
+      std::istringstream input(initialConfig);
+      boost::property_tree::read_info(input, *config);
+      return config;
+    }();
+  return config;
+}
+
 L3Protocol::L3Protocol()
   : m_impl(new Impl())
 {
@@ -208,12 +221,18 @@ L3Protocol::initialize()
 {
   m_impl->m_forwarder = make_shared<nfd::Forwarder>();
 
-  initializeManagement();
+  initializeTables();
+
+  // in the lightweight mode, management is created on the first use (see ensureManagement)
+  bool isLightweight = m_impl->m_config->get<bool>("ndnSIM.lightweight", false);
+  if (!isLightweight) {
+    initializeManagement();
+  }
 
   nfd::FaceTable& faceTable = m_impl->m_forwarder->getFaceTable();
   faceTable.addReserved(nfd::face::makeNullFace(), nfd::face::FACEID_NULL);
 
-  if (!this->getConfig().get<bool>("ndnSIM.disable_rib_manager", false)) {
+  if (!isLightweight && !m_impl->m_config->get<bool>("ndnSIM.disable_rib_manager", false)) {
     Simulator::ScheduleWithContext(m_node->GetId(), Seconds(0), &L3Protocol::initializeRibManager, this);
   }
 
@@ -245,6 +264,7 @@ private:
 void
 L3Protocol::injectInterest(const Interest& interest)
 {
+  ensureManagement();
   m_impl->m_internalFace->sendInterest(interest);
 }
 
@@ -254,6 +274,44 @@ L3Protocol::setCsReplacementPolicy(const PolicyCreationCallback& policy)
   m_impl->m_policy = policy;
 }
 
+void
+L3Protocol::initializeTables()
+{
+  auto& forwarder = m_impl->m_forwarder;
+  using namespace nfd;
+
+  ConfigFile config(&ConfigFile::ignoreUnknownSection);
+
+  // if we use NFD's CS, we have to specify a replacement policy
+  m_impl->m_csFromNdnSim = GetObject<ContentStore>();
+  if (m_impl->m_csFromNdnSim == nullptr) {
+    forwarder->getCs().setPolicy(m_impl->m_policy());
+  }
+
+  TablesConfigSection tablesConfig(*forwarder);
+  tablesConfig.setConfigFile(config);
+
+#ifdef NFD_HAVE_TRAFFIC_CLASSIFIER
+  // forwarders with traffic classes (see Custom-Stategies) keep their default rules, unless
+  // replaced through the traffic_classes section
+  forwarder->getTrafficClassifier().setConfigFile(config);
+#endif // NFD_HAVE_TRAFFIC_CLASSIFIER
+
+  // apply config
+  config.parse(*m_impl->m_config, false, "ndnSIM.conf");
+
+  tablesConfig.ensureConfigured();
+}
+
+void
+L3Protocol::ensureManagement()
+{
+  if (m_impl->m_dispatcher == nullptr) {
+    NS_LOG_DEBUG("Creating management of the lightweight node");
+    initializeManagement();
+  }
+}
+
 void
 L3Protocol::initializeManagement()
 {
@@ -284,30 +342,23 @@ L3Protocol::initializeManagement()
   //   this->getConfig().get_child("authorizations").get_child("authorize").get_child("privileges").erase("faces");
   // }
 
-  if (!this->getConfig().get<bool>("ndnSIM.disable_strategy_choice_manager", false)) {
+  if (!m_impl->m_config->get<bool>("ndnSIM.disable_strategy_choice_manager", false)) {
     m_impl->m_strategyChoiceManager.reset(new StrategyChoiceManager(forwarder->getStrategyChoice(),
                                                                     *m_impl->m_dispatcher,
                                                                     *m_impl->m_authenticator));
   }
-  else {
+  else if (m_impl->m_config->get_child("authorizations.authorize.privileges").count("strategy-choice") > 0) {
+    // StackHelper removes the privilege from the shared config, so normally no copy is made here
     this->getConfig().get_child("authorizations").get_child("authorize").get_child("privileges").erase("strategy-choice");
   }
 
-  if (!this->getConfig().get<bool>("ndnSIM.disable_forwarder_status_manager", false)) {
+  if (!m_impl->m_config->get<bool>("ndnSIM.disable_forwarder_status_manager", false)) {
     m_impl->m_forwarderStatusManager.reset(new ForwarderStatusManager(*forwarder, *m_impl->m_dispatcher));
   }
 
+  // "tables" section has been applied by initializeTables
   ConfigFile config(&ConfigFile::ignoreUnknownSection);
 
-  // if we use NFD's CS, we have to specify a replacement policy
-  m_impl->m_csFromNdnSim = GetObject<ContentStore>();
-  if (m_impl->m_csFromNdnSim == nullptr) {
-    forwarder->getCs().setPolicy(m_impl->m_policy());
-  }
-
-  TablesConfigSection tablesConfig(*forwarder);
-  tablesConfig.setConfigFile(config);
-
   m_impl->m_authenticator->setConfigFile(config);
 
   // if (!this->getConfig().get<bool>("ndnSIM.disable_face_manager", false)) {
@@ -315,9 +366,7 @@ L3Protocol::initializeManagement()
   // }
 
   // apply config
-  config.parse(m_impl->m_config, false, "ndnSIM.conf");
-
-  tablesConfig.ensureConfigured();
+  config.parse(*m_impl->m_config, false, "ndnSIM.conf");
 
   // add FIB entry for NFD Management Protocol
   Name topPrefix("/localhost/nfd");
@@ -355,7 +404,7 @@ L3Protocol::initializeRibManager()
   m_impl->m_ribManager->setConfigFile(config);
 
   // apply config
-  config.parse(m_impl->m_config, false, "ndnSIM.conf");
+  config.parse(*m_impl->m_config, false, "ndnSIM.conf");
 
   m_impl->m_ribManager->registerWithNfd();
 }
@@ -369,19 +418,33 @@ L3Protocol::getForwarder()
 shared_ptr<nfd::FibManager>
 L3Protocol::getFibManager()
 {
+  ensureManagement();
   return m_impl->m_fibManager;
 }
 
 shared_ptr<nfd::StrategyChoiceManager>
 L3Protocol::getStrategyChoiceManager()
 {
+  ensureManagement();
   return m_impl->m_strategyChoiceManager;
 }
 
 nfd::ConfigSection&
 L3Protocol::getConfig()
 {
-  return m_impl->m_config;
+  // copy on write, as the config may be shared with other nodes
+  if (m_impl->m_ownConfig == nullptr) {
+    m_impl->m_ownConfig = make_shared<nfd::ConfigSection>(*m_impl->m_config);
+    m_impl->m_config = m_impl->m_ownConfig;
+  }
+  return *m_impl->m_ownConfig;
+}
+
+void
+L3Protocol::setConfig(shared_ptr<const nfd::ConfigSection> config)
+{
+  m_impl->m_config = std::move(config);
+  m_impl->m_ownConfig = nullptr;
 }
 
 /*
@@ -146,10 +146,28 @@ public:
 
   /**
    * \brief Get NFD config (boost::property_tree)
+   *
+   * The config is copied first if it is shared with other nodes (see setConfig).  Changes take
+   * effect only if made before the stack is aggregated to the node.
    */
   nfd::ConfigSection&
   getConfig();
 
+  /**
+   * \brief Use @p config as NFD config of the node
+   *
+   * The config is not copied, so a single config (e.g., prepared by StackHelper) can be shared by
+   * any number of nodes.  Only nodes that modify their config with getConfig get a copy.
+   */
+  void
+  setConfig(shared_ptr<const nfd::ConfigSection> config);
+
+  /**
+   * \brief Get the default NFD config, parsed once and shared by all nodes
+   */
+  static shared_ptr<const nfd::ConfigSection>
+  getDefaultConfig();
+
   /**
    * \brief Inject interest through internal Face
    */
@@ -192,9 +210,18 @@ private:
   void
   initialize();
 
+  void
+  initializeTables();
+
   void
   initializeManagement();
 
+  /**
+   * \brief Create management of the lightweight node, if not created yet
+   */
+  void
+  ensureManagement();
+
   void
   initializeRibManager();
 
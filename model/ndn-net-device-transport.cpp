@@ -24,16 +24,108 @@
 #include "../utils/ndn-ns3-packet-tag.hpp"
 
 #include <ndn-cxx/encoding/block.hpp>
+#include <ndn-cxx/encoding/block-helpers.hpp>
 #include <ndn-cxx/interest.hpp>
 #include <ndn-cxx/data.hpp>
+#include <ndn-cxx/lp/packet.hpp>
 
 #include "ns3/queue.h"
 
+#include <algorithm>
+
 NS_LOG_COMPONENT_DEFINE("ndn.NetDeviceTransport");
 
 namespace ns3 {
 namespace ndn {
 
+namespace {
+
+// Data heard from a station are assumed to come through it only for a short time, so that
+// a station that moved away or stopped answering is replaced by broadcasting
+const int64_t UPSTREAM_LIFETIME_MS = 1000;
+const int64_t DEFAULT_INTEREST_LIFETIME_MS = 4000;
+const size_t MAX_LEARNED_ADDRESSES = 10000;
+
+enum class PacketKind {
+  OTHER,
+  INTEREST,
+  DATA,
+  NACK,
+  NEXT_FRAGMENT // fragment of a network packet other than the first one
+};
+
+struct PacketInfo {
+  PacketKind kind = PacketKind::OTHER;
+  bool isFragmented = false;
+  Name name;
+  int64_t lifetimeMs = DEFAULT_INTEREST_LIFETIME_MS;
+};
+
+/**
+ * Extract the kind and the name of the network packet carried by the link-layer packet.  Only
+ * the leading elements of the network packet are decoded, as they may be in the first of
+ * several fragments.
+ */
+PacketInfo
+inspectPacket(const Block& wire)
+{
+  PacketInfo info;
+  try {
+    lp::Packet lpPacket(wire);
+    if (!lpPacket.has<lp::FragmentField>()) {
+      return info; // IDLE packet
+    }
+    if (lpPacket.has<lp::FragIndexField>() && lpPacket.get<lp::FragIndexField>() > 0) {
+      info.kind = PacketKind::NEXT_FRAGMENT;
+      return info;
+    }
+    info.isFragmented = lpPacket.has<lp::FragCountField>() &&
+                        lpPacket.get<lp::FragCountField>() > 1;
+
+    ::ndn::Buffer::const_iterator begin, end;
+    std::tie(begin, end) = lpPacket.get<lp::FragmentField>();
+    const uint8_t* pos = &*begin;
+    const uint8_t* last = pos + std::distance(begin, end);
+
+    uint32_t type = 0;
+    uint64_t length = 0;
+    if (!::ndn::tlv::readType(pos, last, type) || !::ndn::tlv::readVarNumber(pos, last, length)) {
+      return info;
+    }
+    if (type != ::ndn::tlv::Interest && type != ::ndn::tlv::Data) {
+      return info;
+    }
+
+    bool isOk = false;
+    Block element;
+    std::tie(isOk, element) = Block::fromBuffer(pos, last - pos);
+    if (!isOk || element.type() != ::ndn::tlv::Name) {
+      return info;
+    }
+    info.name.wireDecode(element);
+
+    if (type == ::ndn::tlv::Interest) {
+      info.kind = lpPacket.has<lp::NackField>() ? PacketKind::NACK : PacketKind::INTEREST;
+      for (pos += element.size(); isOk && pos < last; pos += element.size()) {
+        std::tie(isOk, element) = Block::fromBuffer(pos, last - pos);
+        if (isOk && element.type() == ::ndn::tlv::InterestLifetime) {
+          info.lifetimeMs = ::ndn::readNonNegativeInteger(element);
+          break;
+        }
+      }
+    }
+    else {
+      info.kind = PacketKind::DATA;
+    }
+  }
+  catch (const ::ndn::tlv::Error&) {
+    info.kind = PacketKind::OTHER;
+  }
+  return info;
+}
+
+} // namespace
+
 NetDeviceTransport::NetDeviceTransport(Ptr<Node> node,
                                        const Ptr<NetDevice>& netDevice,
                                        const std::string& localUri,
@@ -43,6 +135,7 @@ NetDeviceTransport::NetDeviceTransport(Ptr<Node> node,
                                        ::ndn::nfd::LinkType linkType)
   : m_netDevice(netDevice)
   , m_node(node)
+  , m_addressingMode(AddressingMode::BROADCAST)
 {
   this->setLocalUri(FaceUri(localUri));
   this->setRemoteUri(FaceUri(remoteUri));
@@ -110,8 +203,12 @@ NetDeviceTransport::doSend(Packet&& packet)
   ns3Packet->AddHeader(header);
 
   // send the NS3 packet
-  m_netDevice->Send(ns3Packet, m_netDevice->GetBroadcast(),
-                    L3Protocol::ETHERNET_FRAME_TYPE);
+  if (m_addressingMode == AddressingMode::LEARNED_PEER) {
+    m_netDevice->Send(ns3Packet, getDestination(packet.packet), L3Protocol::ETHERNET_FRAME_TYPE);
+  }
+  else {
+    m_netDevice->Send(ns3Packet, m_netDevice->GetBroadcast(), L3Protocol::ETHERNET_FRAME_TYPE);
+  }
 }
 
 // callback
@@ -124,11 +221,19 @@ NetDeviceTransport::receiveFromNetDevice(Ptr<NetDevice> device,
 {
   NS_LOG_FUNCTION(device << p << protocol << from << to << packetType);
 
-  // Convert NS3 packet to NFD packet
-  Ptr<ns3::Packet> packet = p->Copy();
+  if (m_addressingMode == AddressingMode::LEARNED_PEER &&
+      packetType == NetDevice::PACKET_OTHERHOST) {
+    return; // unicast to another station, no need to decode
+  }
 
+  // Convert NS3 packet to NFD packet.  The header is peeked from the const packet, as the
+  // packet is not used afterwards and a copy would also clone its tags and metadata.
   BlockHeader header;
-  packet->RemoveHeader(header);
+  p->PeekHeader(header);
+
+  if (m_addressingMode == AddressingMode::LEARNED_PEER) {
+    learnAddress(header.getBlock(), from);
+  }
 
   auto nfdPacket = Packet(std::move(header.getBlock()));
 
@@ -141,5 +246,123 @@ NetDeviceTransport::GetNetDevice() const
   return m_netDevice;
 }
 
+NetDeviceTransport::AddressingMode
+NetDeviceTransport::getAddressingMode() const
+{
+  return m_addressingMode;
+}
+
+void
+NetDeviceTransport::setAddressingMode(AddressingMode mode)
+{
+  m_addressingMode = mode;
+  m_downstreams.clear();
+  m_upstreams.clear();
+}
+
+void
+NetDeviceTransport::learnAddress(const Block& wire, const Address& from)
+{
+  PacketInfo info = inspectPacket(wire);
+  switch (info.kind) {
+  case PacketKind::INTEREST:
+    learn(m_downstreams, info.name, from, MilliSeconds(info.lifetimeMs));
+    break;
+  case PacketKind::DATA:
+    // a single-component prefix would match every Interest
+    if (info.name.size() >= 2) {
+      learn(m_upstreams, info.name.getPrefix(-1), from, MilliSeconds(UPSTREAM_LIFETIME_MS));
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+Address
+NetDeviceTransport::getDestination(const Block& wire)
+{
+  PacketInfo info = inspectPacket(wire);
+  if (info.kind == PacketKind::NEXT_FRAGMENT) {
+    return m_fragmentsDestination;
+  }
+
+  Address destination = m_netDevice->GetBroadcast();
+  switch (info.kind) {
+  case PacketKind::INTEREST: {
+    auto upstreams = find(m_upstreams, info.name, 1);
+    // the station the Interest was received from, if it is forwarded
+    auto downstreams = find(m_downstreams, info.name, info.name.size());
+    if (upstreams.size() == 1 && !upstreams.front()->second.isAmbiguous &&
+        (downstreams.empty() ||
+         (!downstreams.front()->second.isAmbiguous &&
+          downstreams.front()->second.address != upstreams.front()->second.address))) {
+      destination = upstreams.front()->second.address;
+    }
+    break;
+  }
+  case PacketKind::DATA:
+  case PacketKind::NACK: {
+    // Data can satisfy Interests for any prefix of its name
+    auto downstreams = find(m_downstreams, info.name,
+                            info.kind == PacketKind::DATA ? 1 : info.name.size());
+    if (downstreams.size() == 1 && !downstreams.front()->second.isAmbiguous) {
+      destination = downstreams.front()->second.address;
+    }
+    for (const auto& downstream : downstreams) {
+      m_downstreams.erase(downstream);
+    }
+    break;
+  }
+  default:
+    break;
+  }
+
+  if (info.isFragmented) {
+    m_fragmentsDestination = destination;
+  }
+  return destination;
+}
+
+void
+NetDeviceTransport::learn(LearnedAddresses& addresses, const Name& name, const Address& from,
+                          Time lifetime)
+{
+  Time now = Simulator::Now();
+  if (addresses.size() >= MAX_LEARNED_ADDRESSES) {
+    for (auto entry = addresses.begin(); entry != addresses.end();) {
+      entry = entry->second.expiry <= now ? addresses.erase(entry) : std::next(entry);
+    }
+    if (addresses.size() >= MAX_LEARNED_ADDRESSES) {
+      addresses.clear(); // everything is broadcast until relearned
+    }
+  }
+
+  auto entry = addresses.find(name);
+  if (entry == addresses.end() || entry->second.expiry <= now) {
+    addresses[name] = LearnedAddress{from, false, now + lifetime};
+    return;
+  }
+  if (entry->second.address != from) {
+    NS_LOG_DEBUG("More than one station heard for " << name << ", broadcasting");
+    entry->second.isAmbiguous = true;
+  }
+  entry->second.expiry = std::max(entry->second.expiry, now + lifetime);
+}
+
+std::vector<NetDeviceTransport::LearnedAddresses::iterator>
+NetDeviceTransport::find(LearnedAddresses& addresses, const Name& name, size_t minLength)
+{
+  std::vector<LearnedAddresses::iterator> entries;
+  Time now = Simulator::Now();
+  for (size_t length = name.size(); length >= std::max<size_t>(minLength, 1); --length) {
+    auto entry = addresses.find(length == name.size() ? name : name.getPrefix(length));
+    if (entry != addresses.end() && entry->second.expiry > now) {
+      entries.push_back(entry);
+    }
+  }
+  return entries;
+}
+
 } // namespace ndn
 } // namespace ns3
@@ -32,6 +32,9 @@
 #include "ns3/point-to-point-net-device.h"
 #include "ns3/channel.h"
 
+#include <map>
+#include <vector>
+
 namespace ns3 {
 namespace ndn {
 
@@ -42,6 +45,15 @@ namespace ndn {
 class NetDeviceTransport : public nfd::face::Transport
 {
 public:
+  /**
+   * \brief How outgoing packets are addressed on the NetDevice
+   */
+  enum class AddressingMode {
+    BROADCAST,   ///< \brief always send to the broadcast address of the NetDevice
+    LEARNED_PEER ///< \brief send to the station learned for the name of the packet, if exactly
+                 ///< one is known; broadcast otherwise
+  };
+
   NetDeviceTransport(Ptr<Node> node, const Ptr<NetDevice>& netDevice,
                      const std::string& localUri,
                      const std::string& remoteUri,
@@ -54,6 +66,23 @@ public:
   Ptr<NetDevice>
   GetNetDevice() const;
 
+  AddressingMode
+  getAddressingMode() const;
+
+  /**
+   * \brief Select how outgoing packets are addressed
+   *
+   * In LEARNED_PEER mode, the transport remembers which station sent each pending Interest and
+   * which station returned Data under each name prefix (the name of the Data without its last
+   * component).  Data and Nacks are unicast to the station that sent the Interest, and
+   * Interests are unicast to the station that recently returned Data for their prefix, unless
+   * the Interest was received from that station.  Packets are broadcast whenever the station is
+   * unknown or more than one station matches.  Frames that are unicast to other stations are
+   * dropped without decoding.
+   */
+  void
+  setAddressingMode(AddressingMode mode);
+
   virtual ssize_t
   getSendQueueLength() final;
 
@@ -71,8 +100,43 @@ private:
                        const Address& from, const Address& to,
                        NetDevice::PacketType packetType);
 
+  struct LearnedAddress {
+    Address address;
+    bool isAmbiguous; ///< \brief more than one station was heard
+    Time expiry;
+  };
+
+  typedef std::map<Name, LearnedAddress> LearnedAddresses;
+
+  /**
+   * \brief Remember the stations that sent the received Interest or Data (LEARNED_PEER mode)
+   */
+  void
+  learnAddress(const Block& wire, const Address& from);
+
+  /**
+   * \brief Select the destination of the outgoing packet (LEARNED_PEER mode)
+   */
+  Address
+  getDestination(const Block& wire);
+
+  static void
+  learn(LearnedAddresses& addresses, const Name& name, const Address& from, Time lifetime);
+
+  /**
+   * \brief Find the learned, not yet expired, entries for @p name or its prefixes of at least
+   *        @p minLength components
+   */
+  static std::vector<LearnedAddresses::iterator>
+  find(LearnedAddresses& addresses, const Name& name, size_t minLength);
+
   Ptr<NetDevice> m_netDevice; ///< \brief Smart pointer to NetDevice
   Ptr<Node> m_node;
+
+  AddressingMode m_addressingMode;
+  LearnedAddresses m_downstreams; ///< \brief senders of pending Interests, by Interest name
+  LearnedAddresses m_upstreams;   ///< \brief senders of Data, by Data name without last component
+  Address m_fragmentsDestination; ///< \brief destination of the remaining fragments being sent
 };
 
 } // namespace ndn
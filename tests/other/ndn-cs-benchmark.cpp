@@ -0,0 +1,157 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-cs-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/ndnSIM/model/cs/ndn-content-store.hpp"
+
+#include <chrono>
+
+namespace ns3 {
+
+/**
+ * Micro-benchmark of ContentStore lookup hit throughput for the old (ndnSIM) content stores.
+ *
+ * For every policy, the store is filled with `cs-size` Data packets and then `lookups` Interests
+ * for cached names are issued.  Two numbers are reported: the throughput of LookupShared, which
+ * returns the cached Data, and the throughput of Lookup, which returns a deep copy of it.
+ *
+ *     ./waf --run ndn-cs-benchmark --command-template="%s --cs-size=1000 --lookups=1000000"
+ */
+
+class CsBenchmark {
+public:
+  CsBenchmark()
+    : m_csSize(1000)
+    , m_nLookups(1000000)
+    , m_payloadSize(1024)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  shared_ptr<ndn::Data>
+  makeData(const ndn::Name& name) const;
+
+  Ptr<ndn::ContentStore>
+  makeContentStore(const std::string& typeId) const;
+
+  double
+  measure(Ptr<ndn::ContentStore> cs, const std::vector<shared_ptr<const ndn::Interest>>& interests,
+          bool shouldCopy) const;
+
+private:
+  uint32_t m_csSize;
+  uint32_t m_nLookups;
+  uint32_t m_payloadSize;
+};
+
+shared_ptr<ndn::Data>
+CsBenchmark::makeData(const ndn::Name& name) const
+{
+  auto data = make_shared<ndn::Data>(name);
+  data->setContent(make_shared< ::ndn::Buffer>(m_payloadSize));
+
+  ndn::Signature signature;
+  signature.setInfo(ndn::SignatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255)));
+  signature.setValue(::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 0));
+  data->setSignature(signature);
+
+  data->wireEncode();
+  return data;
+}
+
+Ptr<ndn::ContentStore>
+CsBenchmark::makeContentStore(const std::string& typeId) const
+{
+  ObjectFactory factory(typeId);
+  factory.Set("MaxSize", StringValue(std::to_string(m_csSize)));
+  return factory.Create<ndn::ContentStore>();
+}
+
+double
+CsBenchmark::measure(Ptr<ndn::ContentStore> cs,
+                     const std::vector<shared_ptr<const ndn::Interest>>& interests,
+                     bool shouldCopy) const
+{
+  size_t nHits = 0;
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < m_nLookups; ++i) {
+    const shared_ptr<const ndn::Interest>& interest = interests[i % interests.size()];
+    shared_ptr<const ndn::Data> match = shouldCopy ? cs->Lookup(interest)
+                                                   : cs->LookupShared(interest);
+    if (match != nullptr) {
+      nHits += match->getContent().size() > 0;
+    }
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+
+  NS_ABORT_MSG_IF(nHits != m_nLookups, "All lookups are expected to be cache hits");
+  return m_nLookups / elapsed.count();
+}
+
+int
+CsBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("cs-size", "Number of cached Data packets", m_csSize);
+  cmd.AddValue("lookups", "Number of lookups per measurement", m_nLookups);
+  cmd.AddValue("payload-size", "Payload size of cached Data packets", m_payloadSize);
+  cmd.Parse(argc, argv);
+
+  std::vector<shared_ptr<const ndn::Interest>> interests;
+  for (uint32_t i = 0; i < m_csSize; ++i) {
+    ndn::Name name("/prefix");
+    name.appendSequenceNumber(i);
+    interests.push_back(make_shared<ndn::Interest>(name));
+  }
+
+  std::cout << "Policy"
+            << "\t"
+            << "Shared (hits/s)"
+            << "\t"
+            << "Copy (hits/s)"
+            << "\n";
+
+  for (const std::string& policy : {"ns3::ndn::cs::Lru", "ns3::ndn::cs::Lfu", "ns3::ndn::cs::Random"}) {
+    Ptr<ndn::ContentStore> cs = makeContentStore(policy);
+    for (const auto& interest : interests) {
+      cs->Add(makeData(interest->getName()));
+    }
+
+    double shared = measure(cs, interests, false);
+    double copied = measure(cs, interests, true);
+    std::cout << policy << "\t" << shared << "\t" << copied << "\n";
+  }
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::CsBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
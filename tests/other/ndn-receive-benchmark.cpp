@@ -0,0 +1,236 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-receive-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/wifi-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/ndnSIM/model/ndn-block-header.hpp"
+
+#include <chrono>
+
+namespace ns3 {
+
+/**
+ * Micro-benchmark of the per-frame cost of decoding NDN packets received from a net device.
+ *
+ * For point-to-point and ad hoc Wi-Fi devices, a consumer and a producer exchange Interests and
+ * Data, and every frame that NetDeviceTransport receives is captured (with the tags and metadata
+ * the devices attached to it).  The captured frames are then decoded `rounds` times in two
+ * ways: by copying the packet and removing the BlockHeader from the copy, which is what every
+ * received frame cost before, and by peeking the BlockHeader from the const packet, which is
+ * what NetDeviceTransport::receiveFromNetDevice does now.
+ *
+ *     ./waf --run ndn-receive-benchmark --command-template="%s --frames=10000 --rounds=100"
+ */
+
+class ReceiveBenchmark {
+public:
+  ReceiveBenchmark()
+    : m_nFrames(10000)
+    , m_nRounds(100)
+    , m_payloadSize(1024)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  /**
+   * @brief Run a consumer/producer scenario on the nodes created by @p buildTopology
+   * @return frames received by NDN stacks of all nodes
+   */
+  template<class BuildTopology>
+  std::vector<Ptr<const Packet>>
+  capture(const BuildTopology& buildTopology);
+
+  void
+  onFrame(Ptr<NetDevice> device, Ptr<const Packet> packet, uint16_t protocol, const Address& from,
+          const Address& to, NetDevice::PacketType packetType);
+
+  /**
+   * @return average time to decode one of @p frames, in nanoseconds
+   */
+  double
+  measure(const std::vector<Ptr<const Packet>>& frames, bool shouldCopy) const;
+
+  void
+  report(const std::string& deviceName, const std::vector<Ptr<const Packet>>& frames) const;
+
+private:
+  uint32_t m_nFrames;
+  uint32_t m_nRounds;
+  uint32_t m_payloadSize;
+
+  std::vector<Ptr<const Packet>> m_frames;
+};
+
+template<class BuildTopology>
+std::vector<Ptr<const Packet>>
+ReceiveBenchmark::capture(const BuildTopology& buildTopology)
+{
+  NodeContainer nodes = buildTopology();
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.SetDefaultRoutes(true);
+  ndnHelper.Install(nodes);
+
+  m_frames.clear();
+  for (uint32_t i = 0; i < nodes.GetN(); ++i) {
+    // registered the same way as NetDeviceTransport, so it sees the same frames
+    nodes.Get(i)->RegisterProtocolHandler(MakeCallback(&ReceiveBenchmark::onFrame, this),
+                                          ndn::L3Protocol::ETHERNET_FRAME_TYPE, nullptr,
+                                          true /*promiscuous mode*/);
+  }
+
+  ndn::AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+  consumerHelper.SetPrefix("/prefix");
+  consumerHelper.SetAttribute("Frequency", DoubleValue(100.0));
+  consumerHelper.SetAttribute("MaxSeq", IntegerValue(m_nFrames / 2));
+  consumerHelper.Install(nodes.Get(0));
+
+  ndn::AppHelper producerHelper("ns3::ndn::Producer");
+  producerHelper.SetPrefix("/prefix");
+  producerHelper.SetAttribute("PayloadSize", UintegerValue(m_payloadSize));
+  producerHelper.Install(nodes.Get(nodes.GetN() - 1));
+
+  Simulator::Stop(Seconds(m_nFrames / 2 / 100.0 + 10));
+  Simulator::Run();
+
+  // frames are kept alive and measured after the simulation objects are gone
+  Simulator::Destroy();
+  Names::Clear();
+  return std::move(m_frames);
+}
+
+void
+ReceiveBenchmark::onFrame(Ptr<NetDevice> device, Ptr<const Packet> packet, uint16_t protocol,
+                          const Address& from, const Address& to, NetDevice::PacketType packetType)
+{
+  m_frames.push_back(packet);
+}
+
+double
+ReceiveBenchmark::measure(const std::vector<Ptr<const Packet>>& frames, bool shouldCopy) const
+{
+  size_t nBytes = 0;
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t round = 0; round < m_nRounds; ++round) {
+    for (const auto& frame : frames) {
+      ndn::BlockHeader header;
+      if (shouldCopy) {
+        Ptr<Packet> packet = frame->Copy();
+        packet->RemoveHeader(header);
+      }
+      else {
+        frame->PeekHeader(header);
+      }
+      nBytes += header.getBlock().size();
+    }
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+
+  NS_ABORT_MSG_IF(nBytes == 0, "No NDN packets were decoded");
+  return elapsed.count() * 1e9 / (static_cast<double>(frames.size()) * m_nRounds);
+}
+
+void
+ReceiveBenchmark::report(const std::string& deviceName,
+                         const std::vector<Ptr<const Packet>>& frames) const
+{
+  double copied = measure(frames, true);
+  double peeked = measure(frames, false);
+  std::cout << deviceName << "\t" << frames.size() << "\t" << copied << "\t" << peeked << "\n";
+}
+
+int
+ReceiveBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("frames", "Approximate number of frames to capture per device type", m_nFrames);
+  cmd.AddValue("rounds", "Number of times each captured frame is decoded", m_nRounds);
+  cmd.AddValue("payload-size", "Payload size of Data packets", m_payloadSize);
+  cmd.Parse(argc, argv);
+
+  // disable fragmentation
+  Config::SetDefault("ns3::WifiRemoteStationManager::FragmentationThreshold", StringValue("2200"));
+  Config::SetDefault("ns3::WifiRemoteStationManager::RtsCtsThreshold", StringValue("2200"));
+  Config::SetDefault("ns3::WifiRemoteStationManager::NonUnicastMode",
+                     StringValue("OfdmRate24Mbps"));
+
+  std::cout << "Device"
+            << "\t"
+            << "Frames"
+            << "\t"
+            << "Copy (ns/frame)"
+            << "\t"
+            << "Peek (ns/frame)"
+            << "\n";
+
+  report("PointToPoint", capture([] {
+        NodeContainer nodes;
+        nodes.Create(2);
+
+        PointToPointHelper p2p;
+        p2p.SetDeviceAttribute("DataRate", StringValue("100Mbps"));
+        p2p.Install(nodes.Get(0), nodes.Get(1));
+        return nodes;
+      }));
+
+  report("Wifi", capture([] {
+        NodeContainer nodes;
+        nodes.Create(3);
+
+        WifiHelper wifi;
+        wifi.SetStandard(WIFI_PHY_STANDARD_80211a);
+        wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager", "DataMode",
+                                     StringValue("OfdmRate24Mbps"));
+
+        YansWifiChannelHelper wifiChannel = YansWifiChannelHelper::Default();
+        YansWifiPhyHelper wifiPhyHelper = YansWifiPhyHelper::Default();
+        wifiPhyHelper.SetChannel(wifiChannel.Create());
+
+        WifiMacHelper wifiMacHelper;
+        wifiMacHelper.SetType("ns3::AdhocWifiMac");
+        wifi.Install(wifiPhyHelper, wifiMacHelper, nodes);
+
+        // all stations within range of each other, so the third one overhears every frame
+        MobilityHelper mobility;
+        mobility.SetPositionAllocator("ns3::GridPositionAllocator", "DeltaX", DoubleValue(10.0));
+        mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+        mobility.Install(nodes);
+        return nodes;
+      }));
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::ReceiveBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
@@ -0,0 +1,251 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-routing-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/point-to-point-layout-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/ndnSIM/model/ndn-global-router.hpp"
+#include "ns3/ndnSIM/helper/ndn-link-control-helper.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <chrono>
+#include <functional>
+
+namespace ns3 {
+
+/**
+ * Benchmark of route setup time with GlobalRoutingHelper.
+ *
+ * Every topology file in `topologies` (and, if `grid` is non-zero, a grid x grid point-to-point
+ * grid) is loaded, every node is made an origin of its own prefix, and the time spent in
+ * GlobalRoutingHelper::CalculateRoutes is measured with one thread and with `threads` threads.
+ *
+ * In addition, routes are calculated in the dynamic routing mode, up to `links` point-to-point
+ * links are failed and brought back up one at a time with LinkControlHelper, and the average
+ * time of one route repair is reported.
+ *
+ *     ./waf --run ndn-routing-benchmark --command-template="%s --grid=30 --threads=8"
+ */
+
+class RoutingBenchmark {
+public:
+  RoutingBenchmark()
+    : m_topologies("src/ndnSIM/examples/topologies")
+    , m_grid(0)
+    , m_nThreads(0)
+    , m_nLinks(100)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  /**
+   * @brief Build the scenario with @p buildTopology and make every node an origin
+   *
+   * @p buildTopology is called with a function that installs the NDN stack on all nodes.
+   */
+  template<class BuildTopology>
+  void
+  setup(const BuildTopology& buildTopology) const;
+
+  void
+  cleanup() const;
+
+  /**
+   * @brief Build the scenario with @p buildTopology, calculate routes, and clean up
+   * @return time spent in CalculateRoutes, in seconds
+   */
+  template<class BuildTopology>
+  double
+  measure(const BuildTopology& buildTopology, uint32_t nThreads) const;
+
+  /**
+   * @brief Build the scenario with @p buildTopology, calculate routes in the dynamic routing
+   *        mode, fail and restore links, and clean up
+   * @return average time of one link state change, in seconds
+   */
+  template<class BuildTopology>
+  double
+  measureRepair(const BuildTopology& buildTopology, uint32_t nThreads) const;
+
+  template<class BuildTopology>
+  void
+  report(const std::string& topologyName, const BuildTopology& buildTopology) const;
+
+private:
+  std::string m_topologies;
+  uint32_t m_grid;
+  uint32_t m_nThreads;
+  uint32_t m_nLinks;
+};
+
+template<class BuildTopology>
+void
+RoutingBenchmark::setup(const BuildTopology& buildTopology) const
+{
+  buildTopology([] {
+      ndn::StackHelper ndnHelper;
+      ndnHelper.InstallAll();
+    });
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    ndnGlobalRoutingHelper.AddOrigin("/node" + std::to_string((*node)->GetId()), *node);
+  }
+}
+
+void
+RoutingBenchmark::cleanup() const
+{
+  Simulator::Destroy();
+  Names::Clear();
+  ndn::GlobalRouter::clear();
+}
+
+template<class BuildTopology>
+double
+RoutingBenchmark::measure(const BuildTopology& buildTopology, uint32_t nThreads) const
+{
+  setup(buildTopology);
+
+  ndn::GlobalRoutingHelper::SetNumberOfThreads(nThreads);
+  auto begin = std::chrono::steady_clock::now();
+  ndn::GlobalRoutingHelper::CalculateRoutes();
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+
+  cleanup();
+  return elapsed.count();
+}
+
+template<class BuildTopology>
+double
+RoutingBenchmark::measureRepair(const BuildTopology& buildTopology, uint32_t nThreads) const
+{
+  setup(buildTopology);
+
+  ndn::GlobalRoutingHelper::SetNumberOfThreads(nThreads);
+  ndn::GlobalRoutingHelper::SetDynamicRouting(true);
+  ndn::GlobalRoutingHelper::CalculateRoutes();
+
+  std::vector<std::pair<Ptr<Node>, Ptr<Node>>> links;
+  for (ChannelList::Iterator channel = ChannelList::Begin();
+       channel != ChannelList::End() && links.size() < m_nLinks; channel++) {
+    if ((*channel)->GetNDevices() == 2) {
+      links.emplace_back((*channel)->GetDevice(0)->GetNode(), (*channel)->GetDevice(1)->GetNode());
+    }
+  }
+
+  auto begin = std::chrono::steady_clock::now();
+  for (const auto& link : links) {
+    ndn::LinkControlHelper::FailLink(link.first, link.second);
+    ndn::LinkControlHelper::UpLink(link.first, link.second);
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+
+  ndn::GlobalRoutingHelper::SetDynamicRouting(false);
+  cleanup();
+  return links.empty() ? 0 : elapsed.count() / (2 * links.size());
+}
+
+template<class BuildTopology>
+void
+RoutingBenchmark::report(const std::string& topologyName, const BuildTopology& buildTopology) const
+{
+  uint32_t nThreads = m_nThreads;
+  if (nThreads == 0) {
+    ndn::GlobalRoutingHelper::SetNumberOfThreads(0);
+    nThreads = ndn::GlobalRoutingHelper::GetNumberOfThreads();
+  }
+
+  double sequential = measure(buildTopology, 1);
+  double parallel = measure(buildTopology, nThreads);
+  double repair = measureRepair(buildTopology, nThreads);
+  std::cout << topologyName << "\t" << sequential << "\t" << parallel << "\t" << nThreads << "\t"
+            << repair << "\n";
+}
+
+int
+RoutingBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("topologies", "Directory with topology files", m_topologies);
+  cmd.AddValue("grid", "Size of the additional grid topology (0 to disable)", m_grid);
+  cmd.AddValue("threads", "Number of threads in the parallel measurement (0 for all hardware "
+                          "threads)", m_nThreads);
+  cmd.AddValue("links", "Maximum number of links failed and restored in the repair measurement",
+               m_nLinks);
+  cmd.Parse(argc, argv);
+
+  std::vector<boost::filesystem::path> files;
+  for (const auto& entry : boost::filesystem::directory_iterator(m_topologies)) {
+    if (entry.path().extension() == ".txt") {
+      files.push_back(entry.path());
+    }
+  }
+  std::sort(files.begin(), files.end());
+
+  std::cout << "Topology"
+            << "\t"
+            << "1 thread (s)"
+            << "\t"
+            << "N threads (s)"
+            << "\t"
+            << "N"
+            << "\t"
+            << "Repair (s)"
+            << "\n";
+
+  for (const auto& file : files) {
+    report(file.filename().string(), [&file] (const std::function<void()>& installStack) {
+        AnnotatedTopologyReader topologyReader("");
+        topologyReader.SetFileName(file.string());
+        topologyReader.Read();
+        installStack();
+        topologyReader.ApplyOspfMetric();
+      });
+  }
+
+  if (m_grid > 0) {
+    report("grid-" + std::to_string(m_grid) + "x" + std::to_string(m_grid),
+           [this] (const std::function<void()>& installStack) {
+             PointToPointHelper p2p;
+             PointToPointGridHelper grid(m_grid, m_grid, p2p);
+             installStack();
+           });
+  }
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::RoutingBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
@@ -0,0 +1,155 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-trie-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/ndnSIM/utils/trie/trie-with-policy.hpp"
+#include "ns3/ndnSIM/utils/trie/pool-allocator.hpp"
+#include "ns3/ndnSIM/utils/trie/lru-policy.hpp"
+
+#include <chrono>
+
+namespace ns3 {
+
+/**
+ * Micro-benchmark of trie node allocation strategies and lookups.
+ *
+ * The same LRU-managed trie is exercised with heap_allocator_traits (every node and bucket
+ * array is new/delete-d) and with pool_allocator_traits (nodes and bucket arrays are recycled
+ * through per-trie free lists).  Three workloads are measured:
+ *
+ *  - churn: `inserts` insertions of names cycling over a set four times larger than `size`, so
+ *    that (after warm-up) every insertion evicts and prunes the least recently used name;
+ *  - find: `lookups` longest-prefix matches of names one component longer than the cached ones,
+ *    which have to walk the trie;
+ *  - exact: `lookups` longest-prefix matches of cached names, which are answered from the index
+ *    of full-name hashes.
+ *
+ *     ./waf --run ndn-trie-benchmark --command-template="%s --size=10000 --inserts=1000000"
+ */
+
+class TrieBenchmark {
+public:
+  TrieBenchmark()
+    : m_size(10000)
+    , m_nInserts(1000000)
+    , m_nLookups(1000000)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  template<class AllocatorTraits>
+  void
+  measure(const std::string& allocatorName, const std::vector<ndn::Name>& names,
+          const std::vector<ndn::Name>& lookupNames) const;
+
+private:
+  uint32_t m_size;
+  uint32_t m_nInserts;
+  uint32_t m_nLookups;
+};
+
+template<class AllocatorTraits>
+void
+TrieBenchmark::measure(const std::string& allocatorName, const std::vector<ndn::Name>& names,
+                       const std::vector<ndn::Name>& lookupNames) const
+{
+  typedef ndn::ndnSIM::trie_with_policy<ndn::Name, ndn::ndnSIM::non_pointer_traits<uint32_t>,
+                                        ndn::ndnSIM::lru_policy_traits, AllocatorTraits>
+    Trie;
+
+  Trie trie;
+  trie.getPolicy().set_max_size(m_size);
+
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < m_nInserts; ++i) {
+    trie.insert(names[i % names.size()], i + 1); // 0 is the empty payload
+  }
+  std::chrono::duration<double> insertTime = std::chrono::steady_clock::now() - begin;
+
+  size_t nFound = 0;
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < m_nLookups; ++i) {
+    nFound += trie.longest_prefix_match(lookupNames[i % lookupNames.size()]) != trie.end();
+  }
+  std::chrono::duration<double> findTime = std::chrono::steady_clock::now() - begin;
+
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < m_nLookups; ++i) {
+    nFound += trie.longest_prefix_match(names[i % names.size()]) != trie.end();
+  }
+  std::chrono::duration<double> exactTime = std::chrono::steady_clock::now() - begin;
+
+  NS_ABORT_MSG_IF(trie.getPolicy().size() != std::min<size_t>(m_size, names.size()),
+                  "Unexpected number of cached names");
+
+  std::cout << allocatorName << "\t" << m_nInserts / insertTime.count() << "\t"
+            << m_nLookups / findTime.count() << "\t" << m_nLookups / exactTime.count() << "\t"
+            << nFound << "\n";
+}
+
+int
+TrieBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("size", "Maximum number of names in the trie", m_size);
+  cmd.AddValue("inserts", "Number of insertions in the churn measurement", m_nInserts);
+  cmd.AddValue("lookups", "Number of longest-prefix matches in the find measurement", m_nLookups);
+  cmd.Parse(argc, argv);
+
+  std::vector<ndn::Name> names;
+  std::vector<ndn::Name> lookupNames;
+  for (uint32_t i = 0; i < 4 * m_size; ++i) {
+    ndn::Name name("/prefix");
+    name.append("producer" + std::to_string(i % 64));
+    name.appendSequenceNumber(i);
+    names.push_back(name);
+    lookupNames.push_back(ndn::Name(name).appendSegment(0));
+  }
+
+  std::cout << "Allocator"
+            << "\t"
+            << "Churn (inserts/s)"
+            << "\t"
+            << "Find (lookups/s)"
+            << "\t"
+            << "Exact (lookups/s)"
+            << "\t"
+            << "Found"
+            << "\n";
+
+  measure<ndn::ndnSIM::heap_allocator_traits>("heap", names, lookupNames);
+  measure<ndn::ndnSIM::pool_allocator_traits>("pool", names, lookupNames);
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::TrieBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
@@ -0,0 +1,169 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "helper/ndn-stack-helper.hpp"
+#include "model/ndn-l3-protocol.hpp"
+
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+#include "../tests-common.hpp"
+
+// only forwarders from Custom-Stategies have a traffic classifier
+#ifdef NFD_HAVE_TRAFFIC_CLASSIFIER
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::TrafficClassifier;
+using nfd::TrafficClass;
+
+BOOST_FIXTURE_TEST_SUITE(NfdTrafficClassifier, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(DefaultRules)
+{
+  TrafficClassifier classifier;
+
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/root/prefix/1")), nfd::TRAFFIC_CLASS_SENSITIVE);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/root0/a")), nfd::TRAFFIC_CLASS_SENSITIVE);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/root10")), nfd::TRAFFIC_CLASS_SENSITIVE);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/Mid04/%00")), nfd::TRAFFIC_CLASS_MID0);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/Mid110")), nfd::TRAFFIC_CLASS_MID1);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/Mid210/1")), nfd::TRAFFIC_CLASS_MID2);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/Huge0")), nfd::TRAFFIC_CLASS_HUGE);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/Huge11/x")), nfd::TRAFFIC_CLASS_HUGE);
+
+  // labels match only the beginning of the first component
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/prefix/root")), nfd::TRAFFIC_CLASS_DEFAULT);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/myroot")), nfd::TRAFFIC_CLASS_DEFAULT);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/Mid3")), nfd::TRAFFIC_CLASS_DEFAULT);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/roo")), nfd::TRAFFIC_CLASS_DEFAULT);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/video")), nfd::TRAFFIC_CLASS_DEFAULT);
+  BOOST_CHECK_EQUAL(classifier.classify(Name()), nfd::TRAFFIC_CLASS_DEFAULT);
+}
+
+BOOST_AUTO_TEST_CASE(PrefixRules)
+{
+  TrafficClassifier classifier;
+  classifier.insert("/root/bulk", nfd::TRAFFIC_CLASS_HUGE);
+  classifier.insert("/video", nfd::TRAFFIC_CLASS_MID1);
+  classifier.insert("/video/live", nfd::TRAFFIC_CLASS_SENSITIVE);
+
+  // prefix rules take precedence over labels, and the longest prefix wins
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/root/bulk/1")), nfd::TRAFFIC_CLASS_HUGE);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/root/prefix")), nfd::TRAFFIC_CLASS_SENSITIVE);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/video/vod/1")), nfd::TRAFFIC_CLASS_MID1);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/video/live/1")), nfd::TRAFFIC_CLASS_SENSITIVE);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/videos")), nfd::TRAFFIC_CLASS_DEFAULT);
+
+  // a longer label takes precedence over a shorter one
+  classifier.insertLabel("rootX", nfd::TRAFFIC_CLASS_MID2);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/rootX1")), nfd::TRAFFIC_CLASS_MID2);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/root1")), nfd::TRAFFIC_CLASS_SENSITIVE);
+
+  // a label is replaced, not duplicated
+  size_t nRules = classifier.size();
+  classifier.insertLabel("root", nfd::TRAFFIC_CLASS_MID0);
+  BOOST_CHECK_EQUAL(classifier.size(), nRules);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/root1")), nfd::TRAFFIC_CLASS_MID0);
+
+  classifier.clear();
+  BOOST_CHECK_EQUAL(classifier.size(), 0);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/root/bulk/1")), nfd::TRAFFIC_CLASS_DEFAULT);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/Huge1")), nfd::TRAFFIC_CLASS_DEFAULT);
+}
+
+BOOST_AUTO_TEST_CASE(CachedClass)
+{
+  TrafficClassifier classifier;
+  Interest interest("/Huge3/1");
+  BOOST_CHECK_EQUAL(TrafficClassifier::getCachedClass(interest), nfd::TRAFFIC_CLASS_DEFAULT);
+  BOOST_CHECK_EQUAL(classifier.classify(interest), nfd::TRAFFIC_CLASS_HUGE);
+  BOOST_CHECK_EQUAL(TrafficClassifier::getCachedClass(interest), nfd::TRAFFIC_CLASS_HUGE);
+}
+
+BOOST_AUTO_TEST_CASE(ParseClass)
+{
+  BOOST_CHECK_EQUAL(TrafficClassifier::parseClass("default"), nfd::TRAFFIC_CLASS_DEFAULT);
+  BOOST_CHECK_EQUAL(TrafficClassifier::parseClass("sensitive"), nfd::TRAFFIC_CLASS_SENSITIVE);
+  BOOST_CHECK_EQUAL(TrafficClassifier::parseClass("mid2"), nfd::TRAFFIC_CLASS_MID2);
+  BOOST_CHECK_EQUAL(TrafficClassifier::parseClass("huge"), nfd::TRAFFIC_CLASS_HUGE);
+  BOOST_CHECK_THROW(TrafficClassifier::parseClass("Huge"), nfd::ConfigFile::Error);
+  BOOST_CHECK_THROW(TrafficClassifier::parseClass(""), nfd::ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(ConfigSection)
+{
+  const std::string CONFIG =
+    "traffic_classes\n"
+    "{\n"
+    "  /video  huge\n"
+    "  /root*  mid1\n"
+    "}\n";
+
+  TrafficClassifier classifier;
+  nfd::ConfigFile config;
+  classifier.setConfigFile(config);
+
+  // a dry run does not change the rules
+  config.parse(CONFIG, true, "dry-run");
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/root/prefix")), nfd::TRAFFIC_CLASS_SENSITIVE);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/video/1")), nfd::TRAFFIC_CLASS_DEFAULT);
+
+  // the section replaces the default rules
+  config.parse(CONFIG, false, "config");
+  BOOST_CHECK_EQUAL(classifier.size(), 2);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/video/1")), nfd::TRAFFIC_CLASS_HUGE);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/root/prefix")), nfd::TRAFFIC_CLASS_MID1);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/Huge1")), nfd::TRAFFIC_CLASS_DEFAULT);
+
+  // an invalid section leaves the rules intact
+  BOOST_CHECK_THROW(config.parse("traffic_classes\n{\n  /video  fast\n}\n", false, "invalid"),
+                    nfd::ConfigFile::Error);
+  BOOST_CHECK_EQUAL(classifier.classify(Name("/video/1")), nfd::TRAFFIC_CLASS_HUGE);
+}
+
+BOOST_AUTO_TEST_CASE(StackHelperRules)
+{
+  NodeContainer nodes;
+  nodes.Create(2);
+
+  StackHelper ndnHelper;
+  ndnHelper.Install(nodes.Get(0));
+  ndnHelper.addTrafficClass("/video", "huge");
+  ndnHelper.addTrafficClass("/Mid*", "mid2");
+  ndnHelper.Install(nodes.Get(1));
+
+  const TrafficClassifier& defaults =
+    nodes.Get(0)->GetObject<L3Protocol>()->getForwarder()->getTrafficClassifier();
+  BOOST_CHECK_EQUAL(defaults.classify(Name("/video/1")), nfd::TRAFFIC_CLASS_DEFAULT);
+  BOOST_CHECK_EQUAL(defaults.classify(Name("/Mid04")), nfd::TRAFFIC_CLASS_MID0);
+
+  const TrafficClassifier& configured =
+    nodes.Get(1)->GetObject<L3Protocol>()->getForwarder()->getTrafficClassifier();
+  BOOST_CHECK_EQUAL(configured.classify(Name("/video/1")), nfd::TRAFFIC_CLASS_HUGE);
+  BOOST_CHECK_EQUAL(configured.classify(Name("/Mid04")), nfd::TRAFFIC_CLASS_MID2);
+  BOOST_CHECK_EQUAL(configured.classify(Name("/root/prefix")), nfd::TRAFFIC_CLASS_DEFAULT);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NFD_HAVE_TRAFFIC_CLASSIFIER
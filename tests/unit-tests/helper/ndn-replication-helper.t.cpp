@@ -0,0 +1,149 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "helper/ndn-replication-helper.hpp"
+#include "apps/ndn-app.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+const boost::filesystem::path TEST_REPLICATIONS =
+  boost::filesystem::path(TEST_CONFIG_PATH) / "replications";
+
+// each replication is simulated in its own process
+static uint32_t g_nInterests = 0;
+static int64_t g_interestTimes = 0;
+
+static void
+onInterest(shared_ptr<const Interest>, Ptr<App>, shared_ptr<Face>)
+{
+  ++g_nInterests;
+  g_interestTimes += Simulator::Now().GetMicroSeconds();
+}
+
+class ReplicationHelperFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  ReplicationHelperFixture()
+  {
+    boost::filesystem::create_directories(TEST_CONFIG_PATH);
+
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::QueueBase::MaxPackets", UintegerValue(20));
+
+    createTopology({
+        {"1", "2"},
+      });
+
+    addRoutes({
+        {"1", "2", "/prefix", 1},
+      });
+
+    addApps({
+        {"1", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/prefix"}, {"Frequency", "10"}, {"Randomize", "uniform"}},
+            "0s", "100s"},
+        {"2", "ns3::ndn::Producer",
+            {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}},
+            "0s", "100s"}
+      });
+
+    helper.SetOutputDirectory(TEST_REPLICATIONS.string());
+    helper.SetJobs(2);
+    helper.SetRunSetup([] (uint32_t, const std::string&) {
+        Config::ConnectWithoutContext("/NodeList/*/ApplicationList/*/$ns3::ndn::App/"
+                                      "TransmittedInterests", MakeCallback(&onInterest));
+      });
+    helper.SetResultCollector([] (uint32_t) {
+        return ReplicationHelper::Results{{"Interests", std::to_string(g_nInterests)},
+                                          {"InterestTimes", std::to_string(g_interestTimes)}};
+      });
+  }
+
+  ~ReplicationHelperFixture()
+  {
+    boost::filesystem::remove_all(TEST_REPLICATIONS);
+  }
+
+public:
+  ReplicationHelper helper;
+};
+
+BOOST_FIXTURE_TEST_SUITE(HelperNdnReplicationHelper, ReplicationHelperFixture)
+
+BOOST_AUTO_TEST_CASE(Replications)
+{
+  helper.SetReplications(3);
+  BOOST_CHECK_EQUAL(helper.Run(Seconds(10.0)), 0);
+
+  const auto& replications = helper.GetReplications();
+  BOOST_REQUIRE_EQUAL(replications.size(), 3);
+  for (uint32_t i = 0; i < replications.size(); ++i) {
+    BOOST_CHECK_EQUAL(replications[i].run, i + 1);
+    BOOST_CHECK_EQUAL(replications[i].status, "ok");
+    BOOST_REQUIRE_EQUAL(replications[i].results.size(), 2);
+    BOOST_CHECK_GT(std::stoul(replications[i].results[0].second), 50);
+    BOOST_CHECK(boost::filesystem::exists(TEST_REPLICATIONS / ("run-" + std::to_string(i + 1)) /
+                                          "log.txt"));
+  }
+  BOOST_CHECK(replications[0].results != replications[1].results);
+  BOOST_CHECK(replications[1].results != replications[2].results);
+
+  // nothing was simulated in this process
+  BOOST_CHECK_EQUAL(g_nInterests, 0);
+  BOOST_CHECK_EQUAL(Simulator::Now(), Seconds(0));
+
+  std::ifstream is((TEST_REPLICATIONS / "summary.txt").string());
+  std::string line;
+  BOOST_REQUIRE(std::getline(is, line));
+  BOOST_CHECK_EQUAL(line, "Run\tStatus\tWallTime\tInterests\tInterestTimes");
+  size_t nLines = 0;
+  while (std::getline(is, line)) {
+    BOOST_CHECK_EQUAL(line.substr(0, 5), std::to_string(nLines + 1) + "\tok\t");
+    ++nLines;
+  }
+  BOOST_CHECK_EQUAL(nLines, 3);
+}
+
+BOOST_AUTO_TEST_CASE(Reproducibility)
+{
+  helper.SetReplications(2, 5);
+  BOOST_CHECK_EQUAL(helper.Run(Seconds(10.0)), 0);
+  auto replications = helper.GetReplications();
+
+  // the setup is still intact, so the same runs can be repeated
+  helper.SetReplications(1, 6);
+  BOOST_CHECK_EQUAL(helper.Run(Seconds(10.0)), 0);
+  BOOST_REQUIRE_EQUAL(helper.GetReplications().size(), 1);
+  BOOST_CHECK_EQUAL(helper.GetReplications()[0].run, 6);
+  BOOST_CHECK(helper.GetReplications()[0].results == replications[1].results);
+  BOOST_CHECK(helper.GetReplications()[0].results != replications[0].results);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
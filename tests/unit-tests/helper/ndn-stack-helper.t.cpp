@@ -18,6 +18,9 @@
  **/
 
 #include "helper/ndn-stack-helper.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/strategy.hpp"
+
 #include "../tests-common.hpp"
 
 #include "ns3/point-to-point-module.h"
@@ -62,6 +65,70 @@ BOOST_AUTO_TEST_CASE(TestNfdContentStorePolicy)
   BOOST_CHECK_EQUAL(protoNode1->getForwarder()->getCs().getPolicy()->getName(), "priority_fifo");
 }
 
+BOOST_AUTO_TEST_CASE(SharedConfig)
+{
+  NodeContainer nodes;
+  nodes.Create(3);
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.setCsSize(42);
+  ndnHelper.Install(nodes.Get(0));
+  ndnHelper.Install(nodes.Get(1));
+
+  ndnHelper.setCsSize(7);
+  ndnHelper.Install(nodes.Get(2));
+
+  BOOST_CHECK_EQUAL(L3Protocol::getL3Protocol(nodes.Get(0))->getForwarder()->getCs().getLimit(), 42);
+  BOOST_CHECK_EQUAL(L3Protocol::getL3Protocol(nodes.Get(1))->getForwarder()->getCs().getLimit(), 42);
+  BOOST_CHECK_EQUAL(L3Protocol::getL3Protocol(nodes.Get(2))->getForwarder()->getCs().getLimit(), 7);
+
+  // nodes that were installed with the same settings share the config, which is copied on write
+  Ptr<L3Protocol> ndn0 = L3Protocol::getL3Protocol(nodes.Get(0));
+  Ptr<L3Protocol> ndn1 = L3Protocol::getL3Protocol(nodes.Get(1));
+  ndn0->getConfig().put("tables.cs_max_packets", 1);
+  BOOST_CHECK_EQUAL(ndn0->getConfig().get<size_t>("tables.cs_max_packets"), 1);
+  BOOST_CHECK_EQUAL(ndn1->getConfig().get<size_t>("tables.cs_max_packets"), 42);
+  BOOST_CHECK_EQUAL(L3Protocol::getDefaultConfig()->get<size_t>("tables.cs_max_packets"), 100);
+}
+
+BOOST_AUTO_TEST_CASE(Lightweight)
+{
+  NodeContainer nodes;
+  nodes.Create(2);
+
+  PointToPointHelper p2p;
+  p2p.Install(nodes.Get(0), nodes.Get(1));
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.setLightweight(true);
+  ndnHelper.setCsSize(42);
+  ndnHelper.InstallAll();
+
+  Ptr<L3Protocol> ndn = L3Protocol::getL3Protocol(nodes.Get(0));
+  nfd::Forwarder& forwarder = *ndn->getForwarder();
+
+  // tables are configured, but no management is created yet
+  BOOST_CHECK_EQUAL(forwarder.getCs().getLimit(), 42);
+  BOOST_CHECK_EQUAL(forwarder.getStrategyChoice().findEffectiveStrategy("/localhost").getInstanceName(),
+                    Name("/localhost/nfd/strategy/multicast"));
+  BOOST_CHECK(forwarder.getFib().findExactMatch("/localhost/nfd") == nullptr);
+  BOOST_CHECK(forwarder.getFaceTable().get(nfd::face::FACEID_INTERNAL_FACE) == nullptr);
+
+  // the first command creates management
+  FibHelper::AddRoute(nodes.Get(0), "/prefix", nodes.Get(1), 1);
+  BOOST_CHECK(forwarder.getFib().findExactMatch("/localhost/nfd") != nullptr);
+  BOOST_CHECK(forwarder.getFaceTable().get(nfd::face::FACEID_INTERNAL_FACE) != nullptr);
+  BOOST_CHECK(ndn->getFibManager() != nullptr);
+
+  Simulator::Stop(Seconds(1));
+  Simulator::Run();
+  BOOST_CHECK(forwarder.getFib().findExactMatch("/prefix") != nullptr);
+
+  // the other node still has no management
+  BOOST_CHECK(L3Protocol::getL3Protocol(nodes.Get(1))->getForwarder()->getFib()
+                .findExactMatch("/localhost/nfd") == nullptr);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
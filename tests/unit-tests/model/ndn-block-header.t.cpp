@@ -27,6 +27,8 @@
 
 #include "../tests-common.hpp"
 
+#include <chrono>
+
 namespace ns3 {
 namespace ndn {
 
@@ -155,6 +157,68 @@ BOOST_AUTO_TEST_CASE(PrintLpPacket)
   }
 }
 
+BOOST_AUTO_TEST_CASE(SerializeDeserialize)
+{
+  Data data("/other/prefix");
+  data.setContent(std::make_shared< ::ndn::Buffer>(1024));
+  ndn::StackHelper::getKeyChain().sign(data);
+  lp::Packet lpPacket(data.wireEncode());
+  Block wire = lpPacket.wireEncode();
+
+  // a payload behind the header makes the ns-3 buffer consist of several parts
+  Ptr<Packet> packet = Create<Packet>(100);
+  packet->AddHeader(BlockHeader(nfd::face::Transport::Packet(Block(wire))));
+  BOOST_CHECK_EQUAL(packet->GetSize(), wire.size() + 100);
+
+  BlockHeader header;
+  BOOST_CHECK_EQUAL(packet->RemoveHeader(header), wire.size());
+  BOOST_CHECK_EQUAL(packet->GetSize(), 100);
+  BOOST_CHECK_EQUAL_COLLECTIONS(header.getBlock().begin(), header.getBlock().end(),
+                                wire.begin(), wire.end());
+  BOOST_CHECK_EQUAL(Data(header.getBlock()).getName(), data.getName());
+}
+
+BOOST_AUTO_TEST_CASE(DeserializeTruncated)
+{
+  Interest interest("/prefix");
+  interest.setNonce(10);
+  Block wire = interest.wireEncode();
+
+  Ptr<Packet> packet = Create<Packet>(wire.wire(), wire.size() - 1);
+  BlockHeader header;
+  BOOST_CHECK_THROW(packet->RemoveHeader(header), ::ndn::tlv::Error);
+
+  // only the first octet of a three-octet TLV-LENGTH
+  const uint8_t partialLength[] = {0x05, 0xFD};
+  packet = Create<Packet>(partialLength, sizeof(partialLength));
+  BOOST_CHECK_THROW(packet->RemoveHeader(header), ::ndn::tlv::Error);
+}
+
+BOOST_AUTO_TEST_CASE(SerializeDeserializeBenchmark)
+{
+  Data data("/other/prefix");
+  data.setContent(std::make_shared< ::ndn::Buffer>(1024));
+  ndn::StackHelper::getKeyChain().sign(data);
+  nfd::face::Transport::Packet lpPacket(lp::Packet(data.wireEncode()).wireEncode());
+
+  const int N_ITERATIONS = 100000;
+  size_t nBytes = 0;
+  auto begin = std::chrono::steady_clock::now();
+  for (int i = 0; i < N_ITERATIONS; ++i) {
+    Ptr<Packet> packet = Create<Packet>();
+    packet->AddHeader(BlockHeader(lpPacket));
+
+    BlockHeader header;
+    packet->RemoveHeader(header);
+    nBytes += header.getBlock().size();
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+
+  BOOST_CHECK_EQUAL(nBytes, N_ITERATIONS * lpPacket.packet.size());
+  BOOST_TEST_MESSAGE("Serialize+Deserialize of " << lpPacket.packet.size() << "-byte packet: "
+                     << elapsed.count() / N_ITERATIONS * 1e9 << " ns per packet");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
@@ -0,0 +1,209 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "model/ndn-net-device-transport.hpp"
+#include "model/ndn-l3-protocol.hpp"
+#include "helper/ndn-stack-helper.hpp"
+#include "helper/ndn-fib-helper.hpp"
+#include "helper/ndn-app-helper.hpp"
+
+#include "NFD/daemon/face/generic-link-service.hpp"
+
+#include "ns3/wifi-module.h"
+#include "ns3/mobility-module.h"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+static uint32_t g_nReceivedData = 0;
+
+static void
+onData(shared_ptr<const Data>, Ptr<App>, shared_ptr<Face>)
+{
+  ++g_nReceivedData;
+}
+
+// multi-hop forwarding through the same shared-media face requires an ad hoc face
+static shared_ptr<Face>
+createAdHocFace(Ptr<Node> node, Ptr<L3Protocol> ndn, Ptr<NetDevice> device)
+{
+  ::nfd::face::GenericLinkService::Options opts;
+  opts.allowFragmentation = true;
+  opts.allowReassembly = true;
+
+  auto transport = make_unique<NetDeviceTransport>(node, device, "netdev://ad-hoc",
+                                                   "netdev://[ff:ff:ff:ff:ff:ff]",
+                                                   ::ndn::nfd::FACE_SCOPE_NON_LOCAL,
+                                                   ::ndn::nfd::FACE_PERSISTENCY_PERSISTENT,
+                                                   ::ndn::nfd::LINK_TYPE_AD_HOC);
+  transport->setAddressingMode(NetDeviceTransport::AddressingMode::LEARNED_PEER);
+
+  auto face = std::make_shared<Face>(make_unique<::nfd::face::GenericLinkService>(opts),
+                                     std::move(transport));
+  face->setMetric(1);
+  ndn->addFace(face);
+  return face;
+}
+
+class WifiFixture : public CleanupFixture
+{
+public:
+  WifiFixture()
+  {
+    g_nReceivedData = 0;
+  }
+
+  /**
+   * Create a chain of ad hoc Wi-Fi stations 100 meters apart, where every station hears only
+   * its neighbors
+   */
+  void
+  createChain(uint32_t nNodes)
+  {
+    nodes.Create(nNodes);
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_PHY_STANDARD_80211a);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager", "DataMode",
+                                 StringValue("OfdmRate24Mbps"));
+
+    YansWifiChannelHelper wifiChannel;
+    wifiChannel.SetPropagationDelay("ns3::ConstantSpeedPropagationDelayModel");
+    wifiChannel.AddPropagationLoss("ns3::RangePropagationLossModel",
+                                   "MaxRange", DoubleValue(150));
+
+    YansWifiPhyHelper wifiPhy = YansWifiPhyHelper::Default();
+    wifiPhy.SetChannel(wifiChannel.Create());
+
+    WifiMacHelper wifiMac;
+    wifiMac.SetType("ns3::AdhocWifiMac");
+    devices = wifi.Install(wifiPhy, wifiMac, nodes);
+
+    Ptr<ListPositionAllocator> positions = CreateObject<ListPositionAllocator>();
+    for (uint32_t i = 0; i < nNodes; ++i) {
+      positions->Add(Vector(100.0 * i, 0, 0));
+    }
+    MobilityHelper mobility;
+    mobility.SetPositionAllocator(positions);
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(nodes);
+
+    for (uint32_t i = 0; i < nNodes; ++i) {
+      nodes.Get(i)->RegisterProtocolHandler(MakeCallback(&WifiFixture::countFrame, this),
+                                            L3Protocol::ETHERNET_FRAME_TYPE, devices.Get(i),
+                                            true);
+    }
+    nUnicastFrames.assign(nNodes, 0);
+    nBroadcastFrames.assign(nNodes, 0);
+  }
+
+  void
+  installApps(uint32_t consumer, uint32_t producer)
+  {
+    AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+    consumerHelper.SetPrefix("/prefix");
+    consumerHelper.SetAttribute("Frequency", StringValue("10"));
+    consumerHelper.Install(nodes.Get(consumer)).Stop(Seconds(5.0));
+
+    AppHelper producerHelper("ns3::ndn::Producer");
+    producerHelper.SetPrefix("/prefix");
+    producerHelper.SetAttribute("PayloadSize", StringValue("100"));
+    producerHelper.Install(nodes.Get(producer));
+
+    Config::ConnectWithoutContext("/NodeList/*/ApplicationList/*/$ns3::ndn::App/"
+                                  "ReceivedDatas", MakeCallback(&onData));
+  }
+
+private:
+  void
+  countFrame(Ptr<NetDevice> device, Ptr<const ns3::Packet>, uint16_t, const Address&,
+             const Address&, NetDevice::PacketType packetType)
+  {
+    uint32_t node = device->GetNode()->GetId();
+    if (packetType == NetDevice::PACKET_HOST) {
+      ++nUnicastFrames[node];
+    }
+    else if (packetType == NetDevice::PACKET_BROADCAST) {
+      ++nBroadcastFrames[node];
+    }
+  }
+
+public:
+  NodeContainer nodes;
+  NetDeviceContainer devices;
+  std::vector<uint32_t> nUnicastFrames;   ///< frames unicast to each node
+  std::vector<uint32_t> nBroadcastFrames; ///< broadcast frames heard by each node
+};
+
+BOOST_FIXTURE_TEST_SUITE(ModelNdnNetDeviceTransport, WifiFixture)
+
+BOOST_AUTO_TEST_CASE(BroadcastByDefault)
+{
+  createChain(2);
+
+  StackHelper ndnHelper;
+  ndnHelper.SetDefaultRoutes(true);
+  ndnHelper.Install(nodes);
+  installApps(0, 1);
+
+  Simulator::Stop(Seconds(6.0));
+  Simulator::Run();
+
+  BOOST_CHECK_GE(g_nReceivedData, 45);
+  BOOST_CHECK_EQUAL(nUnicastFrames[0], 0);
+  BOOST_CHECK_EQUAL(nUnicastFrames[1], 0);
+  BOOST_CHECK_GE(nBroadcastFrames[0], 45);
+  BOOST_CHECK_GE(nBroadcastFrames[1], 45);
+}
+
+BOOST_AUTO_TEST_CASE(LearnedPeerAdHocChain)
+{
+  // consumer (0) - router (1) - producer (2); the consumer and the producer cannot hear each
+  // other, and the router hears the consumer long before it hears the producer
+  createChain(3);
+
+  StackHelper ndnHelper;
+  ndnHelper.AddFaceCreateCallback(WifiNetDevice::GetTypeId(), MakeCallback(&createAdHocFace));
+  ndnHelper.Install(nodes);
+
+  for (uint32_t i = 0; i < 2; ++i) {
+    Ptr<L3Protocol> ndn = nodes.Get(i)->GetObject<L3Protocol>();
+    FibHelper::AddRoute(nodes.Get(i), "/prefix", ndn->getFaceByNetDevice(devices.Get(i)), 1);
+  }
+  installApps(0, 2);
+
+  Simulator::Stop(Seconds(6.0));
+  Simulator::Run();
+
+  // every Interest reached the producer through the router and every Data came back
+  BOOST_CHECK_GE(g_nReceivedData, 45);
+
+  // after the first exchange, the router unicasts Interests to the producer and Data to the
+  // consumer, and the producer unicasts Data to the router
+  BOOST_CHECK_GE(nUnicastFrames[0], 40);
+  BOOST_CHECK_GE(nUnicastFrames[1], 40);
+  BOOST_CHECK_GE(nUnicastFrames[2], 40);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -17,6 +17,7 @@
  * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
  **/
 
+#include <set>
 
 #include "../tests-common.hpp"
 
@@ -67,6 +68,95 @@ BOOST_AUTO_TEST_CASE(RandomPolicy)
   BOOST_CHECK(entries["1"] != entries["2"]); // this test has a small chance of failing
 }
 
+BOOST_AUTO_TEST_CASE(LookupSharesCachedData)
+{
+  ObjectFactory factory("ns3::ndn::cs::Lru");
+  Ptr<ContentStore> cs = factory.Create<ContentStore>();
+
+  auto data = make_shared<Data>("/prefix/1");
+  data->setSignature(Signature(SignatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255)),
+                               ::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 0)));
+  data->wireEncode();
+  BOOST_CHECK(cs->Add(data));
+
+  shared_ptr<const Data> match1 = cs->LookupShared(make_shared<Interest>("/prefix/1"));
+  shared_ptr<const Data> match2 = cs->LookupShared(make_shared<Interest>("/prefix"));
+  BOOST_CHECK_EQUAL(match1, data);
+  BOOST_CHECK_EQUAL(match2, data);
+  BOOST_CHECK(cs->LookupShared(make_shared<Interest>("/other")) == nullptr);
+
+  // Lookup still returns a modifiable copy
+  shared_ptr<Data> copy = cs->Lookup(make_shared<Interest>("/prefix/1"));
+  BOOST_REQUIRE(copy != nullptr);
+  BOOST_CHECK(copy != data);
+  BOOST_CHECK_EQUAL(*copy, *data);
+  BOOST_CHECK(cs->Lookup(make_shared<Interest>("/other")) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(MaxBytes)
+{
+  std::vector<shared_ptr<Data>> datas;
+  for (int i = 0; i < 10; ++i) {
+    auto data = make_shared<Data>(Name("/prefix").appendSequenceNumber(i));
+    data->setContent(make_shared< ::ndn::Buffer>(1000));
+    data->setSignature(Signature(SignatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255)),
+                                 ::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 0)));
+    data->wireEncode();
+    datas.push_back(data);
+  }
+  // all Data have the same size, and exactly four of them fit
+  size_t dataSize = datas.front()->wireEncode().size();
+  size_t maxBytes = 4 * dataSize + dataSize / 2;
+
+  auto big = make_shared<Data>("/big");
+  big->setContent(make_shared< ::ndn::Buffer>(maxBytes));
+  big->setSignature(datas.front()->getSignature());
+  big->wireEncode();
+
+  for (const std::string& policy : {"ns3::ndn::cs::Lru", "ns3::ndn::cs::Lfu", "ns3::ndn::cs::Fifo",
+                                    "ns3::ndn::cs::Random", "ns3::ndn::cs::Freshness::Lru",
+                                    "ns3::ndn::cs::Probability::Lru"}) {
+    BOOST_TEST_MESSAGE(policy);
+
+    ObjectFactory factory(policy);
+    factory.Set("MaxSize", StringValue("0"));
+    factory.Set("MaxBytes", StringValue(std::to_string(maxBytes)));
+    Ptr<ContentStore> cs = factory.Create<ContentStore>();
+
+    for (const auto& data : datas) {
+      cs->Add(data);
+    }
+    // a Data larger than the whole limit is not cached and does not evict anything
+    cs->Add(big);
+
+    std::set<Name> names;
+    size_t nBytes = 0;
+    for (auto it = cs->Begin(); it != cs->End(); it = cs->Next(it)) {
+      names.insert(it->GetName());
+      nBytes += it->GetData()->wireEncode().size();
+    }
+
+    BOOST_CHECK_EQUAL(cs->GetSize(), 4);
+    BOOST_CHECK_EQUAL(names.size(), 4);
+    BOOST_CHECK_EQUAL(nBytes, 4 * dataSize);
+    BOOST_CHECK_EQUAL(names.count("/big"), 0);
+
+    if (policy == "ns3::ndn::cs::Random") {
+      for (const auto& name : names) {
+        BOOST_CHECK(name.getPrefix(1) == "/prefix");
+      }
+    }
+    else {
+      // all entries are equally (in)frequently used, so the oldest ones are evicted
+      std::set<Name> newest;
+      for (int i = 6; i < 10; ++i) {
+        newest.insert(datas[i]->getName());
+      }
+      BOOST_CHECK_EQUAL_COLLECTIONS(names.begin(), names.end(), newest.begin(), newest.end());
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
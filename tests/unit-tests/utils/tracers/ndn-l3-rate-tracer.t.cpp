@@ -18,16 +18,22 @@
  **/
 
 #include "utils/tracers/ndn-l3-rate-tracer.hpp"
+#include "utils/tracers/binary-trace-reader.hpp"
 
 #include <boost/filesystem.hpp>
 #include <boost/test/output_test_stream.hpp>
 
+#include <fstream>
+#include <sstream>
+
 #include "../../tests-common.hpp"
 
 namespace ns3 {
 namespace ndn {
 
 const boost::filesystem::path TEST_TRACE = boost::filesystem::path(TEST_CONFIG_PATH) / "trace.txt";
+const boost::filesystem::path TEST_BINARY_TRACE =
+  boost::filesystem::path(TEST_CONFIG_PATH) / "trace.bin";
 
 class L3RateTracerFixture : public ScenarioHelperWithCleanupFixture
 {
@@ -55,6 +61,7 @@ public:
   ~L3RateTracerFixture()
   {
     boost::filesystem::remove(TEST_TRACE);
+    boost::filesystem::remove(TEST_BINARY_TRACE);
     L3RateTracer::Destroy(); // additional cleanup
   }
 };
@@ -119,6 +126,29 @@ BOOST_AUTO_TEST_CASE(NackTracing)
   BOOST_CHECK(os.match_pattern());
 }
 
+BOOST_AUTO_TEST_CASE(BinaryTracing)
+{
+  L3RateTracer::InstallAll(TEST_TRACE.string(), Seconds(1));
+  L3RateTracer::InstallAll(TEST_BINARY_TRACE.string(), Seconds(1), TraceFormat::BINARY_COMPRESSED);
+
+  Simulator::Stop(Seconds(2.5));
+  Simulator::Run();
+
+  L3RateTracer::Destroy(); // to force log to be written
+
+  std::ifstream text(TEST_TRACE.string());
+  std::ostringstream expected;
+  expected << text.rdbuf();
+
+  std::ifstream binary(TEST_BINARY_TRACE.string(), std::ios_base::binary);
+  BinaryTraceReader reader(binary);
+  boost::test_tools::output_test_stream os;
+  reader.PrintText(os);
+
+  BOOST_CHECK(!expected.str().empty());
+  BOOST_CHECK(os.is_equal(expected.str()));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
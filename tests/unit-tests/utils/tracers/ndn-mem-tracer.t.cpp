@@ -0,0 +1,135 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/tracers/ndn-mem-tracer.hpp"
+#include "utils/table-mem-usage.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+const boost::filesystem::path TEST_MEM_TRACE =
+  boost::filesystem::path(TEST_CONFIG_PATH) / "mem-trace.txt";
+
+class MemTracerFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  MemTracerFixture()
+  {
+    boost::filesystem::create_directories(TEST_CONFIG_PATH);
+
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::QueueBase::MaxPackets", UintegerValue(20));
+
+    createTopology({
+        {"1", "2"},
+      });
+
+    addRoutes({
+        {"1", "2", "/prefix", 1},
+      });
+
+    addApps({
+        {"1", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/prefix"}, {"Frequency", "1"}},
+            "0s", "0.9s"}, // send just one packet
+        {"2", "ns3::ndn::Producer",
+            {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}},
+            "0s", "100s"}
+      });
+  }
+
+  ~MemTracerFixture()
+  {
+    boost::filesystem::remove(TEST_MEM_TRACE);
+    MemTracer::Destroy(); // additional cleanup
+  }
+
+  static TableMemUsage::Table
+  findTable(const std::vector<TableMemUsage::Table>& tables, const std::string& name)
+  {
+    for (const auto& table : tables) {
+      if (table.name == name) {
+        return table;
+      }
+    }
+    BOOST_ERROR("Table " << name << " not found");
+    return {name, 0, 0};
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTracersNdnMemTracer, MemTracerFixture)
+
+BOOST_AUTO_TEST_CASE(TableUsage)
+{
+  Simulator::Stop(Seconds(0.5));
+  Simulator::Run();
+
+  std::vector<TableMemUsage::Table> tables = TableMemUsage::Get(getNode("1"));
+  BOOST_CHECK_EQUAL(tables.size(), 7);
+
+  TableMemUsage::Table fib = findTable(tables, "Fib");
+  BOOST_CHECK_GE(fib.nEntries, 1);
+  BOOST_CHECK_GT(fib.nBytes, 0);
+
+  TableMemUsage::Table cs = findTable(tables, "Cs");
+  BOOST_CHECK_EQUAL(cs.nEntries, 1);
+  BOOST_CHECK_GT(cs.nBytes, 1024);
+
+  BOOST_CHECK_EQUAL(findTable(tables, "Pit").nEntries, 0);
+  BOOST_CHECK_GE(findTable(tables, "NameTree").nEntries, fib.nEntries + cs.nEntries);
+}
+
+BOOST_AUTO_TEST_CASE(Tracing)
+{
+  NodeContainer nodes;
+  nodes.Add(getNode("1"));
+
+  MemTracer::Install(nodes, TEST_MEM_TRACE.string(), Seconds(1));
+
+  Simulator::Stop(Seconds(1.5));
+  Simulator::Run();
+
+  MemTracer::Destroy(); // to force log to be written
+
+  std::ifstream is(TEST_MEM_TRACE.string());
+  std::string line;
+  BOOST_REQUIRE(std::getline(is, line));
+  BOOST_CHECK_EQUAL(line, "Time\tNode\tTable\tEntries\tBytes");
+
+  std::vector<std::string> tables;
+  while (std::getline(is, line)) {
+    BOOST_CHECK_EQUAL(line.substr(0, 4), "1\t1\t");
+    tables.push_back(line.substr(4, line.find('\t', 4) - 4));
+  }
+  BOOST_CHECK_EQUAL(tables.size(), 7);
+  BOOST_CHECK_EQUAL(tables.front(), "NameTree");
+  BOOST_CHECK_EQUAL(tables.back(), "DeadNonceList");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,130 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/tracers/threaded-trace-writer.hpp"
+
+#include <sstream>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+// writes the same rows into a threaded writer and directly into a text writer
+class ThreadedTraceWriterFixture
+{
+public:
+  ThreadedTraceWriterFixture()
+    : output(std::make_shared<std::stringstream>())
+    , expected(expectedOutput)
+  {
+  }
+
+  std::unique_ptr<ThreadedTraceWriter>
+  makeWriter(size_t capacity)
+  {
+    return make_unique<ThreadedTraceWriter>(make_unique<TextTraceWriter>(*output), output,
+                                            capacity);
+  }
+
+  void
+  addRow(TraceWriter& writer, uint32_t i, const std::string& name)
+  {
+    for (TraceWriter* w : {&writer, static_cast<TraceWriter*>(&expected)}) {
+      w->AddTime(MilliSeconds(i));
+      w->AddString(name);
+      w->AddInteger(-static_cast<int64_t>(i));
+      w->AddReal(i / 4.0);
+      w->EndRow();
+    }
+  }
+
+public:
+  std::shared_ptr<std::stringstream> output;
+  std::ostringstream expectedOutput;
+  TextTraceWriter expected;
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTracersThreadedTraceWriter, ThreadedTraceWriterFixture)
+
+BOOST_AUTO_TEST_CASE(Overflow)
+{
+  const uint32_t N_ROWS = 10000;
+
+  auto writer = makeWriter(2);
+  for (uint32_t i = 0; i < N_ROWS; ++i) {
+    addRow(*writer, i, "node" + std::to_string(i % 7));
+  }
+  uint64_t nOverflows = writer->GetNOverflows();
+  writer.reset(); // writes all rows
+
+  // a ring of two records cannot hold a row
+  BOOST_CHECK_GT(nOverflows, 0);
+
+  BOOST_CHECK_EQUAL(output->str(), expectedOutput.str());
+  size_t nLines = 0;
+  std::string line;
+  while (std::getline(*output, line)) {
+    ++nLines;
+  }
+  BOOST_CHECK_EQUAL(nLines, N_ROWS);
+}
+
+BOOST_AUTO_TEST_CASE(Strings)
+{
+  // new strings are sent in records of 8 bytes, repeated ones as indices
+  const std::vector<std::string> STRINGS = {
+    "", "a", "12345678", "123456789", "1234567812345678", "12345678123456789",
+    std::string("with\0nul", 8), "appFace://node-with-a-long-name/", "", "a", "123456789"
+  };
+
+  auto writer = makeWriter(1024);
+  for (uint32_t i = 0; i < STRINGS.size(); ++i) {
+    addRow(*writer, i, STRINGS[i]);
+  }
+  writer.reset();
+
+  BOOST_CHECK_EQUAL(output->str(), expectedOutput.str());
+
+  std::string line;
+  for (const auto& str : STRINGS) {
+    BOOST_REQUIRE(std::getline(*output, line));
+    size_t begin = line.find('\t') + 1;
+    BOOST_CHECK_EQUAL(line.substr(begin, line.find('\t', begin) - begin), str);
+  }
+  BOOST_CHECK(!std::getline(*output, line));
+}
+
+BOOST_AUTO_TEST_CASE(EmptyRowsAndFlushOnDestruction)
+{
+  auto writer = makeWriter(4);
+  writer->EndRow();
+  writer->AddString("");
+  writer->EndRow();
+  writer->AddInteger(1);
+  // the incomplete row is written when the writer is destroyed
+  writer.reset();
+
+  BOOST_CHECK_EQUAL(output->str(), "\n\n1");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -25,6 +25,8 @@
 // #include <unistd.h>
 // // #include <sys/resource.h>
 #include <sys/sysinfo.h>
+#include <unistd.h>
+#include <fstream>
 #endif
 
 #ifdef __APPLE__
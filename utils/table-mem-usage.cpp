@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "table-mem-usage.hpp"
+
+#include "ns3/node.h"
+
+#include "model/ndn-l3-protocol.hpp"
+#include "model/cs/ndn-content-store.hpp"
+
+#include "daemon/fw/forwarder.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+namespace {
+
+uint64_t
+getNameBytes(const Name& name)
+{
+  uint64_t nBytes = sizeof(Name);
+  for (const auto& component : name) {
+    nBytes += sizeof(name::Component) + component.size();
+  }
+  return nBytes;
+}
+
+uint64_t
+getInterestBytes(const Interest& interest)
+{
+  return sizeof(Interest) + (interest.hasWire() ? interest.wireEncode().size()
+                                                : getNameBytes(interest.getName()));
+}
+
+} // namespace
+
+std::vector<TableMemUsage::Table>
+TableMemUsage::Get(Ptr<Node> node)
+{
+  std::vector<Table> tables;
+
+  Ptr<L3Protocol> ndn = node->GetObject<L3Protocol>();
+  if (ndn == nullptr) {
+    return tables;
+  }
+  nfd::Forwarder& forwarder = *ndn->getForwarder();
+
+  const nfd::NameTree& nameTree = forwarder.getNameTree();
+  Table nameTreeUsage{"NameTree", nameTree.size(), nameTree.getNBuckets() * sizeof(void*)};
+  for (const auto& entry : nameTree) {
+    nameTreeUsage.nBytes += sizeof(entry) + getNameBytes(entry.getName());
+  }
+  tables.push_back(nameTreeUsage);
+
+  const nfd::Fib& fib = forwarder.getFib();
+  Table fibUsage{"Fib", fib.size(), 0};
+  for (const auto& entry : fib) {
+    // the prefix is shared with the name tree entry
+    fibUsage.nBytes += sizeof(entry) + entry.getNextHops().capacity() * sizeof(nfd::fib::NextHop);
+  }
+  tables.push_back(fibUsage);
+
+  const nfd::Pit& pit = forwarder.getPit();
+  Table pitUsage{"Pit", pit.size(), 0};
+  for (const auto& entry : pit) {
+    pitUsage.nBytes += sizeof(entry) + getInterestBytes(entry.getInterest());
+    for (const auto& inRecord : entry.getInRecords()) {
+      // in-records keep their own copy of the Interest, which usually shares the wire buffer
+      pitUsage.nBytes += sizeof(inRecord) + 2 * sizeof(void*);
+    }
+    pitUsage.nBytes += entry.getOutRecords().size()
+                       * (sizeof(nfd::pit::OutRecord) + 2 * sizeof(void*));
+  }
+  tables.push_back(pitUsage);
+
+  const nfd::cs::Cs& cs = forwarder.getCs();
+  Table csUsage{"Cs", cs.size(), 0};
+  for (const auto& entry : cs) {
+    const Data& data = entry.getData();
+    csUsage.nBytes += sizeof(entry) + sizeof(Data)
+                      + (data.hasWire() ? data.wireEncode().size() : 0);
+  }
+  tables.push_back(csUsage);
+
+  // the remaining tables are small and their entries have (nearly) fixed size
+  const nfd::Measurements& measurements = forwarder.getMeasurements();
+  tables.push_back({"Measurements", measurements.size(),
+                    measurements.size() * sizeof(nfd::measurements::Entry)});
+
+  const nfd::StrategyChoice& strategyChoice = forwarder.getStrategyChoice();
+  tables.push_back({"StrategyChoice", strategyChoice.size(),
+                    strategyChoice.size() * sizeof(nfd::strategy_choice::Entry)});
+
+  // each nonce is a node of a sequenced and a hashed index
+  const nfd::DeadNonceList& deadNonceList = forwarder.getDeadNonceList();
+  tables.push_back({"DeadNonceList", deadNonceList.size(),
+                    deadNonceList.size() * (sizeof(uint64_t) + 4 * sizeof(void*))});
+
+  Ptr<ContentStore> contentStore = node->GetObject<ContentStore>();
+  if (contentStore != nullptr) {
+    ContentStore::MemoryUsage usage = contentStore->GetMemoryUsage();
+    tables.push_back({"ContentStore", contentStore->GetSize(), usage.nDataBytes});
+    tables.push_back({"ContentStoreTrie", usage.nIndexNodes, usage.nIndexBytes});
+  }
+
+  return tables;
+}
+
+} // namespace ndn
+} // namespace ns3
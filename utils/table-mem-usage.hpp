@@ -0,0 +1,71 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_TABLE_MEM_USAGE_HPP
+#define NDNSIM_UTILS_TABLE_MEM_USAGE_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/ptr.h"
+
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+class Node;
+
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Utility class to estimate memory used by the forwarding tables of a node
+ *
+ * Unlike MemUsage, which reports the resident size of the whole process, the estimates are
+ * computed per node and per table by walking the tables, so memory growth can be attributed
+ * to a specific table.  The byte counts include the table entries, their names, and the
+ * packets they hold, but not the overhead of the general-purpose allocator.
+ */
+class TableMemUsage {
+public:
+  /**
+   * @brief Estimated memory used by one table
+   */
+  struct Table {
+    std::string name; ///< @brief name of the table (e.g., Pit, Fib, ContentStore)
+    uint64_t nEntries; ///< @brief number of entries (number of nodes for index tables)
+    uint64_t nBytes;   ///< @brief estimated number of bytes
+  };
+
+  /**
+   * @brief Get memory estimates for all tables of @p node
+   *
+   * Returns NameTree, Fib, Pit, Cs, Measurements, StrategyChoice, and DeadNonceList tables of
+   * the NFD forwarder and, if an ndnSIM content store is aggregated to the node, ContentStore
+   * (cached Data packets) and ContentStoreTrie (the trie index) tables.  An empty list is
+   * returned if NDN stack is not installed on the node.
+   */
+  static std::vector<Table>
+  Get(Ptr<Node> node);
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_TABLE_MEM_USAGE_HPP
@@ -0,0 +1,204 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "binary-trace-reader.hpp"
+
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+
+#include <cstring>
+
+namespace ns3 {
+
+namespace io = boost::iostreams;
+
+namespace {
+
+std::string
+readBytes(std::istream& is, size_t size)
+{
+  std::string buffer(size, '\0');
+  if (size > 0 && !is.read(&buffer[0], size)) {
+    throw BinaryTraceReader::Error("Unexpected end of the trace");
+  }
+  return buffer;
+}
+
+uint64_t
+parseNumber(const char* data, size_t size)
+{
+  uint64_t value = 0;
+  for (size_t i = 0; i < size; ++i) {
+    value |= static_cast<uint64_t>(static_cast<uint8_t>(data[i])) << (8 * i);
+  }
+  return value;
+}
+
+uint64_t
+readNumber(std::istream& is, size_t size)
+{
+  return parseNumber(readBytes(is, size).data(), size);
+}
+
+size_t
+getValueSize(TraceWriter::ColumnType type)
+{
+  return type == TraceWriter::STRING ? 4 : 8;
+}
+
+} // namespace
+
+BinaryTraceReader::BinaryTraceReader(std::istream& is)
+  : m_is(is)
+  , m_nRows(0)
+{
+  if (readBytes(m_is, 8) != "NDNTRACE") {
+    throw Error("Not a binary trace");
+  }
+  uint32_t version = readNumber(m_is, 4);
+  if (version != BinaryTraceWriter::VERSION) {
+    throw Error("Unsupported trace version " + std::to_string(version));
+  }
+  m_timeStepsPerSecond = readNumber(m_is, 8);
+
+  uint32_t nColumns = readNumber(m_is, 4);
+  for (uint32_t i = 0; i < nColumns; ++i) {
+    uint8_t type = readNumber(m_is, 1);
+    if (type > TraceWriter::REAL) {
+      throw Error("Unknown column type " + std::to_string(type));
+    }
+    std::string name = readBytes(m_is, readNumber(m_is, 4));
+    m_columns.push_back({name, static_cast<TraceWriter::ColumnType>(type)});
+  }
+}
+
+bool
+BinaryTraceReader::ReadChunk()
+{
+  if (m_is.peek() == std::istream::traits_type::eof()) {
+    m_nRows = 0;
+    return false;
+  }
+
+  uint8_t flags = readNumber(m_is, 1);
+  uint32_t payloadSize = readNumber(m_is, 4);
+  std::string stored = readBytes(m_is, readNumber(m_is, 4));
+
+  if (flags & 1) {
+    io::filtering_istream decompressor;
+    decompressor.push(io::zlib_decompressor());
+    decompressor.push(io::array_source(stored.data(), stored.size()));
+    try {
+      m_payload = readBytes(decompressor, payloadSize);
+    }
+    catch (const io::zlib_error&) {
+      throw Error("Corrupted compressed chunk");
+    }
+  }
+  else {
+    m_payload = std::move(stored);
+  }
+  if (m_payload.size() != payloadSize || payloadSize < 8) {
+    throw Error("Malformed chunk");
+  }
+
+  m_nRows = parseNumber(&m_payload[0], 4);
+  uint32_t nNewStrings = parseNumber(&m_payload[4], 4);
+  size_t offset = 8;
+  for (uint32_t i = 0; i < nNewStrings; ++i) {
+    if (offset + 4 > m_payload.size()) {
+      throw Error("Malformed chunk");
+    }
+    size_t length = parseNumber(&m_payload[offset], 4);
+    offset += 4;
+    if (offset + length > m_payload.size()) {
+      throw Error("Malformed chunk");
+    }
+    m_dictionary.push_back(m_payload.substr(offset, length));
+    offset += length;
+  }
+
+  m_offsets.clear();
+  for (const auto& column : m_columns) {
+    m_offsets.push_back(offset);
+    offset += getValueSize(column.type) * m_nRows;
+  }
+  if (offset != m_payload.size()) {
+    throw Error("Malformed chunk");
+  }
+  return true;
+}
+
+uint64_t
+BinaryTraceReader::GetValue(size_t column, uint32_t row) const
+{
+  size_t size = getValueSize(m_columns[column].type);
+  return parseNumber(&m_payload[m_offsets[column] + size * row], size);
+}
+
+void
+BinaryTraceReader::PrintRow(std::ostream& os, uint32_t row) const
+{
+  for (size_t column = 0; column < m_columns.size(); ++column) {
+    if (column > 0) {
+      os << "\t";
+    }
+
+    uint64_t value = GetValue(column, row);
+    switch (m_columns[column].type) {
+    case TraceWriter::TIME:
+      os << static_cast<int64_t>(value) / m_timeStepsPerSecond;
+      break;
+    case TraceWriter::STRING:
+      if (value >= m_dictionary.size()) {
+        throw Error("Unknown string " + std::to_string(value));
+      }
+      os << m_dictionary[value];
+      break;
+    case TraceWriter::INTEGER:
+      os << static_cast<int64_t>(value);
+      break;
+    case TraceWriter::REAL: {
+      double real;
+      std::memcpy(&real, &value, sizeof(real));
+      os << real;
+      break;
+    }
+    }
+  }
+  os << "\n";
+}
+
+void
+BinaryTraceReader::PrintText(std::ostream& os)
+{
+  for (size_t column = 0; column < m_columns.size(); ++column) {
+    os << (column > 0 ? "\t" : "") << m_columns[column].name;
+  }
+  os << "\n";
+
+  while (ReadChunk()) {
+    for (uint32_t row = 0; row < m_nRows; ++row) {
+      PrintRow(os, row);
+    }
+  }
+}
+
+} // namespace ns3
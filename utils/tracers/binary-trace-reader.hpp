@@ -0,0 +1,102 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef BINARY_TRACE_READER_H
+#define BINARY_TRACE_READER_H
+
+#include "trace-writer.hpp"
+
+#include <istream>
+#include <stdexcept>
+
+namespace ns3 {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Reader of traces written by BinaryTraceWriter
+ */
+class BinaryTraceReader : boost::noncopyable {
+public:
+  class Error : public std::runtime_error {
+  public:
+    explicit Error(const std::string& what)
+      : std::runtime_error(what)
+    {
+    }
+  };
+
+  /**
+   * @brief Read the file header
+   * @throw Error the stream does not contain a binary trace
+   */
+  explicit BinaryTraceReader(std::istream& is);
+
+  const std::vector<TraceWriter::Column>&
+  GetColumns() const
+  {
+    return m_columns;
+  }
+
+  /**
+   * @brief Read the next chunk
+   * @return false if there are no more chunks
+   * @throw Error the chunk is truncated or malformed
+   */
+  bool
+  ReadChunk();
+
+  /**
+   * @brief Number of rows in the current chunk
+   */
+  uint32_t
+  GetNRows() const
+  {
+    return m_nRows;
+  }
+
+  /**
+   * @brief Print @p row of the current chunk in the text layout of the tracers
+   */
+  void
+  PrintRow(std::ostream& os, uint32_t row) const;
+
+  /**
+   * @brief Print the header line and all remaining rows in the text layout of the tracers
+   */
+  void
+  PrintText(std::ostream& os);
+
+private:
+  uint64_t
+  GetValue(size_t column, uint32_t row) const;
+
+private:
+  std::istream& m_is;
+  std::vector<TraceWriter::Column> m_columns;
+  double m_timeStepsPerSecond;
+
+  std::vector<std::string> m_dictionary;
+  std::string m_payload;
+  std::vector<size_t> m_offsets; // per column, in m_payload
+  uint32_t m_nRows;
+};
+
+} // namespace ns3
+
+#endif // BINARY_TRACE_READER_H
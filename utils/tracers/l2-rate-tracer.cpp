@@ -18,6 +18,7 @@
  **/
 
 #include "l2-rate-tracer.hpp"
+#include "tracer-scheduler.hpp"
 
 #include "ns3/node.h"
 #include "ns3/packet.h"
@@ -44,14 +45,26 @@ L2RateTracer::Destroy()
   g_tracers.clear();
 }
 
+static const std::vector<TraceWriter::Column> COLUMNS = {
+  {"Time", TraceWriter::TIME},
+  {"Node", TraceWriter::STRING},
+  {"Interface", TraceWriter::STRING},
+  {"Type", TraceWriter::STRING},
+  {"Packets", TraceWriter::INTEGER},
+  {"Kilobytes", TraceWriter::INTEGER},
+  {"PacketsRaw", TraceWriter::INTEGER},
+  {"KilobytesRaw", TraceWriter::REAL},
+};
+
 void
-L2RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/)
+L2RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/,
+                         TraceFormat format /* = TraceFormat::TEXT*/)
 {
   std::list<Ptr<L2RateTracer>> tracers;
   std::shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     std::shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -64,15 +77,22 @@ L2RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seco
     outputStream = std::shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
   }
 
+  std::shared_ptr<TraceWriter> writer;
+  if (format != TraceFormat::TEXT) {
+    writer = std::make_shared<BinaryTraceWriter>(outputStream, COLUMNS,
+                                                 format == TraceFormat::BINARY_COMPRESSED);
+  }
+
   for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
     NS_LOG_DEBUG("Node: " << boost::lexical_cast<std::string>((*node)->GetId()));
 
     Ptr<L2RateTracer> trace = Create<L2RateTracer>(outputStream, *node);
     trace->SetAveragingPeriod(averagingPeriod);
+    trace->m_writer = writer;
     tracers.push_back(trace);
   }
 
-  if (tracers.size() > 0) {
+  if (tracers.size() > 0 && writer == nullptr) {
     // *m_l3RateTrace << "# "; // not necessary for R's read.table
     tracers.front()->PrintHeader(*outputStream);
     *outputStream << "\n";
@@ -84,30 +104,30 @@ L2RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seco
 L2RateTracer::L2RateTracer(std::shared_ptr<std::ostream> os, Ptr<Node> node)
   : L2Tracer(node)
   , m_os(os)
+  , m_printerId(0)
 {
   SetAveragingPeriod(Seconds(1.0));
 }
 
 L2RateTracer::~L2RateTracer()
 {
-  m_printEvent.Cancel();
+  TracerScheduler::Remove(m_printerId);
 }
 
 void
 L2RateTracer::SetAveragingPeriod(const Time& period)
 {
   m_period = period;
-  m_printEvent.Cancel();
-  m_printEvent = Simulator::Schedule(m_period, &L2RateTracer::PeriodicPrinter, this);
-}
-
-void
-L2RateTracer::PeriodicPrinter()
-{
-  Print(*m_os);
-  Reset();
-
-  m_printEvent = Simulator::Schedule(m_period, &L2RateTracer::PeriodicPrinter, this);
+  TracerScheduler::Remove(m_printerId);
+  m_printerId = TracerScheduler::Add(m_period, m_os, [this] (std::ostream& os) {
+      if (m_writer != nullptr) {
+        Write(*m_writer);
+      }
+      else {
+        Print(os);
+      }
+      Reset();
+    });
 }
 
 void
@@ -150,12 +170,25 @@ const double alpha = 0.8;
   STATS(3).fieldName = /*new value*/ alpha * RATE(1, fieldName) / 1024.0                           \
                        + /*old value*/ (1 - alpha) * STATS(3).fieldName;                           \
                                                                                                    \
-  os << time.ToDouble(Time::S) << "\t" << m_node << "\t" << interface << "\t" << printName << "\t" \
-     << STATS(2).fieldName << "\t" << STATS(3).fieldName << "\t" << STATS(0).fieldName << "\t"     \
-     << STATS(1).fieldName / 1024.0 << "\n";
+  writer.AddTime(time);                                                                            \
+  writer.AddString(m_node);                                                                        \
+  writer.AddString(interface);                                                                     \
+  writer.AddString(printName);                                                                     \
+  writer.AddInteger(STATS(2).fieldName);                                                           \
+  writer.AddInteger(STATS(3).fieldName);                                                           \
+  writer.AddInteger(STATS(0).fieldName);                                                           \
+  writer.AddReal(STATS(1).fieldName / 1024.0);                                                     \
+  writer.EndRow();
 
 void
 L2RateTracer::Print(std::ostream& os) const
+{
+  TextTraceWriter writer(os);
+  Write(writer);
+}
+
+void
+L2RateTracer::Write(TraceWriter& writer) const
 {
   Time time = Simulator::Now();
 
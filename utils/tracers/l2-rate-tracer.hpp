@@ -21,9 +21,9 @@
 #define L2_RATE_TRACER_H
 
 #include "l2-tracer.hpp"
+#include "trace-writer.hpp"
 
 #include "ns3/nstime.h"
-#include "ns3/event-id.h"
 
 #include <tuple>
 #include <map>
@@ -51,6 +51,8 @@ public:
    * @param averagingPeriod Defines averaging period for the rate calculation,
    *        as well as how often data will be written into the trace file (default, every half
    *second)
+   * @param format Format of the trace file; binary traces can be converted to the text layout
+   *        with BinaryTraceReader (e.g., using the ndn-trace-converter program)
    *
    * @returns a tuple of reference to output stream and list of tracers. !!! Attention !!! This
    *tuple needs to be preserved
@@ -58,7 +60,8 @@ public:
    *
    */
   static void
-  InstallAll(const std::string& file, Time averagingPeriod = Seconds(0.5));
+  InstallAll(const std::string& file, Time averagingPeriod = Seconds(0.5),
+             TraceFormat format = TraceFormat::TEXT);
 
   /**
    * @brief Explicit request to remove all statically created tracers
@@ -83,15 +86,16 @@ public:
 
 private:
   void
-  PeriodicPrinter();
+  Write(TraceWriter& writer) const;
 
   void
   Reset();
 
 private:
   std::shared_ptr<std::ostream> m_os;
+  std::shared_ptr<TraceWriter> m_writer; // binary writer shared by the tracers of the file, if any
   Time m_period;
-  EventId m_printEvent;
+  uint64_t m_printerId;
 
   mutable std::tuple<Stats, Stats, Stats, Stats> m_stats;
 };
@@ -18,6 +18,7 @@
  **/
 
 #include "ndn-app-delay-tracer.hpp"
+#include "threaded-trace-writer.hpp"
 #include "ns3/node.h"
 #include "ns3/packet.h"
 #include "ns3/config.h"
@@ -48,8 +49,37 @@ AppDelayTracer::Destroy()
   g_tracers.clear();
 }
 
+static const std::vector<TraceWriter::Column> COLUMNS = {
+  {"Time", TraceWriter::TIME},
+  {"Node", TraceWriter::STRING},
+  {"AppId", TraceWriter::INTEGER},
+  {"SeqNo", TraceWriter::INTEGER},
+  {"Type", TraceWriter::STRING},
+  {"DelayS", TraceWriter::REAL},
+  {"DelayUS", TraceWriter::REAL},
+  {"RetxCount", TraceWriter::INTEGER},
+  {"HopCount", TraceWriter::INTEGER},
+};
+
+/**
+ * @brief Create a writer that formats and writes rows to @p outputStream on an I/O thread
+ */
+static shared_ptr<TraceWriter>
+makeWriter(shared_ptr<std::ostream> outputStream, TraceFormat format)
+{
+  std::unique_ptr<TraceWriter> target;
+  if (format == TraceFormat::TEXT) {
+    target.reset(new TextTraceWriter(*outputStream));
+  }
+  else {
+    target.reset(new BinaryTraceWriter(outputStream, COLUMNS,
+                                       format == TraceFormat::BINARY_COMPRESSED));
+  }
+  return make_shared<ThreadedTraceWriter>(std::move(target), outputStream);
+}
+
 void
-AppDelayTracer::InstallAll(const std::string& file)
+AppDelayTracer::InstallAll(const std::string& file, TraceFormat format /* = TraceFormat::TEXT*/)
 {
   using namespace boost;
   using namespace std;
@@ -58,7 +88,7 @@ AppDelayTracer::InstallAll(const std::string& file)
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -71,12 +101,14 @@ AppDelayTracer::InstallAll(const std::string& file)
     outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
   }
 
+  shared_ptr<TraceWriter> writer = makeWriter(outputStream, format);
   for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
     Ptr<AppDelayTracer> trace = Install(*node, outputStream);
+    trace->m_writer = writer;
     tracers.push_back(trace);
   }
 
-  if (tracers.size() > 0) {
+  if (tracers.size() > 0 && format == TraceFormat::TEXT) {
     // *m_l3RateTrace << "# "; // not necessary for R's read.table
     tracers.front()->PrintHeader(*outputStream);
     *outputStream << "\n";
@@ -108,8 +140,10 @@ AppDelayTracer::Install(const NodeContainer& nodes, const std::string& file)
     outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
   }
 
+  shared_ptr<TraceWriter> writer = makeWriter(outputStream, TraceFormat::TEXT);
   for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
     Ptr<AppDelayTracer> trace = Install(*node, outputStream);
+    trace->m_writer = writer;
     tracers.push_back(trace);
   }
 
@@ -146,6 +180,7 @@ AppDelayTracer::Install(Ptr<Node> node, const std::string& file)
   }
 
   Ptr<AppDelayTracer> trace = Install(node, outputStream);
+  trace->m_writer = makeWriter(outputStream, TraceFormat::TEXT);
   tracers.push_back(trace);
 
   if (tracers.size() > 0) {
@@ -230,26 +265,37 @@ AppDelayTracer::PrintHeader(std::ostream& os) const
      << "";
 }
 
+void
+AppDelayTracer::Write(Ptr<App> app, uint32_t seqno, const std::string& type, Time delay,
+                      uint32_t retxCount, int32_t hopCount)
+{
+  TextTraceWriter textWriter(*m_os);
+  TraceWriter& writer = m_writer != nullptr ? *m_writer : textWriter;
+
+  writer.AddTime(Simulator::Now());
+  writer.AddString(m_node);
+  writer.AddInteger(app->GetId());
+  writer.AddInteger(seqno);
+  writer.AddString(type);
+  writer.AddReal(delay.ToDouble(Time::S));
+  writer.AddReal(delay.ToDouble(Time::US));
+  writer.AddInteger(retxCount);
+  writer.AddInteger(hopCount);
+  writer.EndRow();
+}
+
 void
 AppDelayTracer::LastRetransmittedInterestDataDelay(Ptr<App> app, uint32_t seqno, Time delay,
                                                    int32_t hopCount)
 {
-  *m_os << Simulator::Now().ToDouble(Time::S) << "\t" << m_node << "\t" << app->GetId() << "\t"
-        << seqno << "\t"
-        << "LastDelay"
-        << "\t" << delay.ToDouble(Time::S) << "\t" << delay.ToDouble(Time::US) << "\t" << 1 << "\t"
-        << hopCount << "\n";
+  Write(app, seqno, "LastDelay", delay, 1, hopCount);
 }
 
 void
 AppDelayTracer::FirstInterestDataDelay(Ptr<App> app, uint32_t seqno, Time delay, uint32_t retxCount,
                                        int32_t hopCount)
 {
-  *m_os << Simulator::Now().ToDouble(Time::S) << "\t" << m_node << "\t" << app->GetId() << "\t"
-        << seqno << "\t"
-        << "FullDelay"
-        << "\t" << delay.ToDouble(Time::S) << "\t" << delay.ToDouble(Time::US) << "\t" << retxCount
-        << "\t" << hopCount << "\n";
+  Write(app, seqno, "FullDelay", delay, retxCount, hopCount);
 }
 
 } // namespace ndn
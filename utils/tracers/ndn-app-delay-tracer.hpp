@@ -21,6 +21,7 @@
 #define CCNX_APP_DELAY_TRACER_H
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "trace-writer.hpp"
 
 #include "ns3/ptr.h"
 #include "ns3/simple-ref-count.h"
@@ -43,6 +44,9 @@ class App;
 /**
  * @ingroup ndn-tracers
  * @brief Tracer to obtain application-level delays
+ *
+ * Tracers installed with a file name push their rows to a ThreadedTraceWriter, so rows are
+ * formatted and written on a dedicated I/O thread rather than on the simulation thread.
  */
 class AppDelayTracer : public SimpleRefCount<AppDelayTracer> {
 public:
@@ -50,10 +54,12 @@ public:
    * @brief Helper method to install tracers on all simulation nodes
    *
    * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param format Format of the trace file; binary traces can be converted to the text layout
+   *        with BinaryTraceReader (e.g., using the ndn-trace-converter program)
    *
    */
   static void
-  InstallAll(const std::string& file);
+  InstallAll(const std::string& file, TraceFormat format = TraceFormat::TEXT);
 
   /**
    * @brief Helper method to install tracers on the selected simulation nodes
@@ -131,6 +137,10 @@ private:
   void
   Connect();
 
+  void
+  Write(Ptr<App> app, uint32_t seqno, const std::string& type, Time delay, uint32_t retxCount,
+        int32_t hopCount);
+
   void
   LastRetransmittedInterestDataDelay(Ptr<App> app, uint32_t seqno, Time delay, int32_t hopCount);
 
@@ -143,6 +153,7 @@ private:
   Ptr<Node> m_nodePtr;
 
   shared_ptr<std::ostream> m_os;
+  shared_ptr<TraceWriter> m_writer; // I/O thread writer shared by the tracers of the file, if any
 };
 
 } // namespace ndn
@@ -18,6 +18,7 @@
  **/
 
 #include "ndn-cs-tracer.hpp"
+#include "tracer-scheduler.hpp"
 #include "ns3/node.h"
 #include "ns3/packet.h"
 #include "ns3/config.h"
@@ -47,8 +48,16 @@ CsTracer::Destroy()
   g_tracers.clear();
 }
 
+static const std::vector<TraceWriter::Column> COLUMNS = {
+  {"Time", TraceWriter::TIME},
+  {"Node", TraceWriter::STRING},
+  {"Type", TraceWriter::STRING},
+  {"Packets", TraceWriter::REAL},
+};
+
 void
-CsTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/)
+CsTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/,
+                     TraceFormat format /* = TraceFormat::TEXT*/)
 {
   using namespace boost;
   using namespace std;
@@ -57,7 +66,7 @@ CsTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -70,12 +79,19 @@ CsTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds
     outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
   }
 
+  shared_ptr<TraceWriter> writer;
+  if (format != TraceFormat::TEXT) {
+    writer = make_shared<BinaryTraceWriter>(outputStream, COLUMNS,
+                                            format == TraceFormat::BINARY_COMPRESSED);
+  }
+
   for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
     Ptr<CsTracer> trace = Install(*node, outputStream, averagingPeriod);
+    trace->m_writer = writer;
     tracers.push_back(trace);
   }
 
-  if (tracers.size() > 0) {
+  if (tracers.size() > 0 && writer == nullptr) {
     // *m_l3RateTrace << "# "; // not necessary for R's read.table
     tracers.front()->PrintHeader(*outputStream);
     *outputStream << "\n";
@@ -177,6 +193,7 @@ CsTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream,
 CsTracer::CsTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
   : m_nodePtr(node)
   , m_os(os)
+  , m_printerId(0)
 {
   m_node = boost::lexical_cast<std::string>(m_nodePtr->GetId());
 
@@ -191,11 +208,15 @@ CsTracer::CsTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
 CsTracer::CsTracer(shared_ptr<std::ostream> os, const std::string& node)
   : m_node(node)
   , m_os(os)
+  , m_printerId(0)
 {
   Connect();
 }
 
-CsTracer::~CsTracer(){};
+CsTracer::~CsTracer()
+{
+  TracerScheduler::Remove(m_printerId);
+}
 
 void
 CsTracer::Connect()
@@ -211,17 +232,16 @@ void
 CsTracer::SetAveragingPeriod(const Time& period)
 {
   m_period = period;
-  m_printEvent.Cancel();
-  m_printEvent = Simulator::Schedule(m_period, &CsTracer::PeriodicPrinter, this);
-}
-
-void
-CsTracer::PeriodicPrinter()
-{
-  Print(*m_os);
-  Reset();
-
-  m_printEvent = Simulator::Schedule(m_period, &CsTracer::PeriodicPrinter, this);
+  TracerScheduler::Remove(m_printerId);
+  m_printerId = TracerScheduler::Add(m_period, m_os, [this] (std::ostream& os) {
+      if (m_writer != nullptr) {
+        Write(*m_writer);
+      }
+      else {
+        Print(os);
+      }
+      Reset();
+    });
 }
 
 void
@@ -246,11 +266,21 @@ CsTracer::Reset()
 }
 
 #define PRINTER(printName, fieldName)                                                              \
-  os << time.ToDouble(Time::S) << "\t" << m_node << "\t" << printName << "\t" << m_stats.fieldName \
-     << "\n";
+  writer.AddTime(time);                                                                            \
+  writer.AddString(m_node);                                                                        \
+  writer.AddString(printName);                                                                     \
+  writer.AddReal(m_stats.fieldName);                                                               \
+  writer.EndRow();
 
 void
 CsTracer::Print(std::ostream& os) const
+{
+  TextTraceWriter writer(os);
+  Write(writer);
+}
+
+void
+CsTracer::Write(TraceWriter& writer) const
 {
   Time time = Simulator::Now();
 
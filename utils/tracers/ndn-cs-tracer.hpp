@@ -21,11 +21,11 @@
 #define CCNX_CS_TRACER_H
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "trace-writer.hpp"
 
 #include "ns3/ptr.h"
 #include "ns3/simple-ref-count.h"
 #include <ns3/nstime.h>
-#include <ns3/event-id.h>
 #include <ns3/node-container.h>
 
 #include <tuple>
@@ -67,6 +67,8 @@ public:
    * @param file File to which traces will be written.  If filename is -, then std::out is used
    * @param averagingPeriod How often data will be written into the trace file (default, every half
    *second)
+   * @param format Format of the trace file; binary traces can be converted to the text layout
+   *        with BinaryTraceReader (e.g., using the ndn-trace-converter program)
    *
    * @returns a tuple of reference to output stream and list of tracers. !!! Attention !!! This
    *tuple needs to be preserved
@@ -74,7 +76,8 @@ public:
    *
    */
   static void
-  InstallAll(const std::string& file, Time averagingPeriod = Seconds(0.5));
+  InstallAll(const std::string& file, Time averagingPeriod = Seconds(0.5),
+             TraceFormat format = TraceFormat::TEXT);
 
   /**
    * @brief Helper method to install tracers on the selected simulation nodes
@@ -183,19 +186,20 @@ private:
   SetAveragingPeriod(const Time& period);
 
   void
-  Reset();
+  Write(TraceWriter& writer) const;
 
   void
-  PeriodicPrinter();
+  Reset();
 
 private:
   std::string m_node;
   Ptr<Node> m_nodePtr;
 
   shared_ptr<std::ostream> m_os;
+  shared_ptr<TraceWriter> m_writer; // binary writer shared by the tracers of the file, if any
 
   Time m_period;
-  EventId m_printEvent;
+  uint64_t m_printerId;
   cs::Stats m_stats;
 };
 
@@ -18,6 +18,7 @@
  **/
 
 #include "ndn-l3-rate-tracer.hpp"
+#include "tracer-scheduler.hpp"
 #include "ns3/node.h"
 #include "ns3/packet.h"
 #include "ns3/config.h"
@@ -46,14 +47,27 @@ L3RateTracer::Destroy()
   g_tracers.clear();
 }
 
+static const std::vector<TraceWriter::Column> COLUMNS = {
+  {"Time", TraceWriter::TIME},
+  {"Node", TraceWriter::STRING},
+  {"FaceId", TraceWriter::INTEGER},
+  {"FaceDescr", TraceWriter::STRING},
+  {"Type", TraceWriter::STRING},
+  {"Packets", TraceWriter::REAL},
+  {"Kilobytes", TraceWriter::REAL},
+  {"PacketRaw", TraceWriter::REAL},
+  {"KilobytesRaw", TraceWriter::REAL},
+};
+
 void
-L3RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/)
+L3RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/,
+                         TraceFormat format /* = TraceFormat::TEXT*/)
 {
   std::list<Ptr<L3RateTracer>> tracers;
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -66,12 +80,19 @@ L3RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seco
     outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
   }
 
+  shared_ptr<TraceWriter> writer;
+  if (format != TraceFormat::TEXT) {
+    writer = make_shared<BinaryTraceWriter>(outputStream, COLUMNS,
+                                            format == TraceFormat::BINARY_COMPRESSED);
+  }
+
   for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
     Ptr<L3RateTracer> trace = Install(*node, outputStream, averagingPeriod);
+    trace->m_writer = writer;
     tracers.push_back(trace);
   }
 
-  if (tracers.size() > 0) {
+  if (tracers.size() > 0 && writer == nullptr) {
     // *m_l3RateTrace << "# "; // not necessary for R's read.table
     tracers.front()->PrintHeader(*outputStream);
     *outputStream << "\n";
@@ -169,6 +190,7 @@ L3RateTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream,
 L3RateTracer::L3RateTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
   : L3Tracer(node)
   , m_os(os)
+  , m_printerId(0)
 {
   SetAveragingPeriod(Seconds(1.0));
 }
@@ -176,30 +198,30 @@ L3RateTracer::L3RateTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
 L3RateTracer::L3RateTracer(shared_ptr<std::ostream> os, const std::string& node)
   : L3Tracer(node)
   , m_os(os)
+  , m_printerId(0)
 {
   SetAveragingPeriod(Seconds(1.0));
 }
 
 L3RateTracer::~L3RateTracer()
 {
-  m_printEvent.Cancel();
+  TracerScheduler::Remove(m_printerId);
 }
 
 void
 L3RateTracer::SetAveragingPeriod(const Time& period)
 {
   m_period = period;
-  m_printEvent.Cancel();
-  m_printEvent = Simulator::Schedule(m_period, &L3RateTracer::PeriodicPrinter, this);
-}
-
-void
-L3RateTracer::PeriodicPrinter()
-{
-  Print(*m_os);
-  Reset();
-
-  m_printEvent = Simulator::Schedule(m_period, &L3RateTracer::PeriodicPrinter, this);
+  TracerScheduler::Remove(m_printerId);
+  m_printerId = TracerScheduler::Add(m_period, m_os, [this] (std::ostream& os) {
+      if (m_writer != nullptr) {
+        Write(*m_writer);
+      }
+      else {
+        Print(os);
+      }
+      Reset();
+    });
 }
 
 void
@@ -229,15 +251,23 @@ L3RateTracer::PrintHeader(std::ostream& os) const
 void
 L3RateTracer::Reset()
 {
+  auto reset = [] (FaceStats& stats) {
+    std::get<0>(stats.counters).Reset();
+    std::get<1>(stats.counters).Reset();
+  };
+
   for (auto& stats : m_stats) {
-    std::get<0>(stats.second).Reset();
-    std::get<1>(stats.second).Reset();
+    reset(stats);
+  }
+  for (auto& stats : m_reservedStats) {
+    reset(stats.second);
   }
+  reset(m_totalStats);
 }
 
 const double alpha = 0.8;
 
-#define STATS(INDEX) std::get<INDEX>(stats.second)
+#define STATS(INDEX) std::get<INDEX>(stats.counters)
 #define RATE(INDEX, fieldName) STATS(INDEX).fieldName / m_period.ToDouble(Time::S)
 
 #define PRINTER(printName, fieldName)                                                              \
@@ -246,27 +276,36 @@ const double alpha = 0.8;
   STATS(3).fieldName = /*new value*/ alpha * RATE(1, fieldName) / 1024.0                           \
                        + /*old value*/ (1 - alpha) * STATS(3).fieldName;                           \
                                                                                                    \
-  os << time.ToDouble(Time::S) << "\t" << m_node << "\t";                                          \
-  if (stats.first != nfd::face::INVALID_FACEID) {                                                  \
-    os << stats.first << "\t";                                                                     \
-    NS_ASSERT(m_faceInfos.find(stats.first) != m_faceInfos.end());                                 \
-    os << m_faceInfos.find(stats.first)->second << "\t";                                           \
+  writer.AddTime(time);                                                                            \
+  writer.AddString(m_node);                                                                        \
+  if (faceId != nfd::face::INVALID_FACEID) {                                                       \
+    writer.AddInteger(faceId);                                                                     \
+    writer.AddString(stats.info);                                                                  \
   }                                                                                                \
   else {                                                                                           \
-    os << "-1\tall\t";                                                                             \
+    writer.AddInteger(-1);                                                                         \
+    writer.AddString("all");                                                                       \
   }                                                                                                \
-  os << printName << "\t" << STATS(2).fieldName << "\t" << STATS(3).fieldName << "\t"              \
-     << STATS(0).fieldName << "\t" << STATS(1).fieldName / 1024.0 << "\n";
+  writer.AddString(printName);                                                                     \
+  writer.AddReal(STATS(2).fieldName);                                                              \
+  writer.AddReal(STATS(3).fieldName);                                                              \
+  writer.AddReal(STATS(0).fieldName);                                                              \
+  writer.AddReal(STATS(1).fieldName / 1024.0);                                                     \
+  writer.EndRow();
 
 void
 L3RateTracer::Print(std::ostream& os) const
 {
-  Time time = Simulator::Now();
+  TextTraceWriter writer(os);
+  Write(writer);
+}
 
-  for (auto& stats : m_stats) {
-    if (stats.first == nfd::face::INVALID_FACEID)
-      continue;
+void
+L3RateTracer::Write(TraceWriter& writer) const
+{
+  Time time = Simulator::Now();
 
+  auto printFace = [&] (nfd::FaceId faceId, FaceStats& stats) {
     PRINTER("InInterests", m_inInterests);
     PRINTER("OutInterests", m_outInterests);
 
@@ -281,124 +320,140 @@ L3RateTracer::Print(std::ostream& os) const
 
     PRINTER("OutSatisfiedInterests", m_outSatisfiedInterests);
     PRINTER("OutTimedOutInterests", m_outTimedOutInterests);
-  }
+  };
 
-  {
-    auto i = m_stats.find(nfd::face::INVALID_FACEID);
-    if (i != m_stats.end()) {
-      auto& stats = *i;
-      PRINTER("SatisfiedInterests", m_satisfiedInterests);
-      PRINTER("TimedOutInterests", m_timedOutInterests);
+  // reserved face IDs are smaller than any regular one
+  for (auto& stats : m_reservedStats) {
+    printFace(stats.first, stats.second);
+  }
+  for (size_t i = 0; i < m_stats.size(); ++i) {
+    if (m_stats[i].isUsed) {
+      printFace(i + nfd::face::FACEID_RESERVED_MAX + 1, m_stats[i]);
     }
   }
+
+  if (m_totalStats.isUsed) {
+    nfd::FaceId faceId = nfd::face::INVALID_FACEID;
+    FaceStats& stats = m_totalStats;
+    PRINTER("SatisfiedInterests", m_satisfiedInterests);
+    PRINTER("TimedOutInterests", m_timedOutInterests);
+  }
 }
 
 void
 L3RateTracer::OutInterests(const Interest& interest, const Face& face)
 {
-  AddInfo(face);
-  std::get<0>(m_stats[face.getId()]).m_outInterests++;
+  FaceStats& stats = GetStats(face);
+  std::get<0>(stats.counters).m_outInterests++;
   if (interest.hasWire()) {
-    std::get<1>(m_stats[face.getId()]).m_outInterests +=
-      interest.wireEncode().size();
+    std::get<1>(stats.counters).m_outInterests += interest.wireEncode().size();
   }
 }
 
 void
 L3RateTracer::InInterests(const Interest& interest, const Face& face)
 {
-  AddInfo(face);
-  std::get<0>(m_stats[face.getId()]).m_inInterests++;
+  FaceStats& stats = GetStats(face);
+  std::get<0>(stats.counters).m_inInterests++;
   if (interest.hasWire()) {
-    std::get<1>(m_stats[face.getId()]).m_inInterests +=
-      interest.wireEncode().size();
+    std::get<1>(stats.counters).m_inInterests += interest.wireEncode().size();
   }
 }
 
 void
 L3RateTracer::OutData(const Data& data, const Face& face)
 {
-  AddInfo(face);
-  std::get<0>(m_stats[face.getId()]).m_outData++;
+  FaceStats& stats = GetStats(face);
+  std::get<0>(stats.counters).m_outData++;
   if (data.hasWire()) {
-    std::get<1>(m_stats[face.getId()]).m_outData +=
-      data.wireEncode().size();
+    std::get<1>(stats.counters).m_outData += data.wireEncode().size();
   }
 }
 
 void
 L3RateTracer::InData(const Data& data, const Face& face)
 {
-  AddInfo(face);
-  std::get<0>(m_stats[face.getId()]).m_inData++;
+  FaceStats& stats = GetStats(face);
+  std::get<0>(stats.counters).m_inData++;
   if (data.hasWire()) {
-    std::get<1>(m_stats[face.getId()]).m_inData +=
-      data.wireEncode().size();
+    std::get<1>(stats.counters).m_inData += data.wireEncode().size();
   }
 }
 
 void
 L3RateTracer::OutNack(const lp::Nack& nack, const Face& face)
 {
-  AddInfo(face);
-  std::get<0>(m_stats[face.getId()]).m_outNack++;
+  FaceStats& stats = GetStats(face);
+  std::get<0>(stats.counters).m_outNack++;
   if (nack.getInterest().hasWire()) {
-    std::get<1>(m_stats[face.getId()]).m_outNack +=
-      nack.getInterest().wireEncode().size();
+    std::get<1>(stats.counters).m_outNack += nack.getInterest().wireEncode().size();
   }
 }
 
 void
 L3RateTracer::InNack(const lp::Nack& nack, const Face& face)
 {
-  AddInfo(face);
-  std::get<0>(m_stats[face.getId()]).m_inNack++;
+  FaceStats& stats = GetStats(face);
+  std::get<0>(stats.counters).m_inNack++;
   if (nack.getInterest().hasWire()) {
-    std::get<1>(m_stats[face.getId()]).m_inNack +=
-      nack.getInterest().wireEncode().size();
+    std::get<1>(stats.counters).m_inNack += nack.getInterest().wireEncode().size();
   }
 }
 
 void
 L3RateTracer::SatisfiedInterests(const nfd::pit::Entry& entry, const Face&, const Data&)
 {
-  std::get<0>(m_stats[nfd::face::INVALID_FACEID]).m_satisfiedInterests++;
+  m_totalStats.isUsed = true;
+  std::get<0>(m_totalStats.counters).m_satisfiedInterests++;
   // no "size" stats
 
   for (const auto& in : entry.getInRecords()) {
-    AddInfo(in.getFace());
-    std::get<0>(m_stats[(in.getFace()).getId()]).m_satisfiedInterests ++;
+    std::get<0>(GetStats(in.getFace()).counters).m_satisfiedInterests++;
   }
 
   for (const auto& out : entry.getOutRecords()) {
-    AddInfo(out.getFace());
-    std::get<0>(m_stats[(out.getFace()).getId()]).m_outSatisfiedInterests ++;
+    std::get<0>(GetStats(out.getFace()).counters).m_outSatisfiedInterests++;
   }
 }
 
 void
 L3RateTracer::TimedOutInterests(const nfd::pit::Entry& entry)
 {
-  std::get<0>(m_stats[nfd::face::INVALID_FACEID]).m_timedOutInterests++;
+  m_totalStats.isUsed = true;
+  std::get<0>(m_totalStats.counters).m_timedOutInterests++;
   // no "size" stats
 
   for (const auto& in : entry.getInRecords()) {
-    AddInfo(in.getFace());
-    std::get<0>(m_stats[(in.getFace()).getId()]).m_timedOutInterests++;
+    std::get<0>(GetStats(in.getFace()).counters).m_timedOutInterests++;
   }
 
   for (const auto& out : entry.getOutRecords()) {
-    AddInfo(out.getFace());
-    std::get<0>(m_stats[(out.getFace()).getId()]).m_outTimedOutInterests++;
+    std::get<0>(GetStats(out.getFace()).counters).m_outTimedOutInterests++;
   }
 }
 
-void
-L3RateTracer::AddInfo(const Face& face)
+L3RateTracer::FaceStats&
+L3RateTracer::GetStats(const Face& face)
 {
-  if (m_faceInfos.find(face.getId()) == m_faceInfos.end()) {
-    m_faceInfos.insert(make_pair(face.getId(), boost::lexical_cast<std::string>(face.getLocalUri())));
+  nfd::FaceId faceId = face.getId();
+
+  FaceStats* stats = nullptr;
+  if (faceId > nfd::face::FACEID_RESERVED_MAX) {
+    size_t i = faceId - nfd::face::FACEID_RESERVED_MAX - 1;
+    if (i >= m_stats.size()) {
+      m_stats.resize(i + 1);
+    }
+    stats = &m_stats[i];
+  }
+  else {
+    stats = &m_reservedStats[faceId];
+  }
+
+  if (!stats->isUsed) {
+    stats->isUsed = true;
+    stats->info = boost::lexical_cast<std::string>(face.getLocalUri());
   }
+  return *stats;
 }
 
 } // namespace ndn
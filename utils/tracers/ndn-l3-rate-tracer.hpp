@@ -23,14 +23,15 @@
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 
 #include "ndn-l3-tracer.hpp"
+#include "trace-writer.hpp"
 
 #include "ns3/nstime.h"
-#include "ns3/event-id.h"
 #include "ns3/node-container.h"
 
 #include <tuple>
 #include <map>
 #include <list>
+#include <vector>
 
 namespace ns3 {
 namespace ndn {
@@ -48,9 +49,12 @@ public:
    * @param averagingPeriod Defines averaging period for the rate calculation,
    *        as well as how often data will be written into the trace file (default, every half
    *second)
+   * @param format Format of the trace file; binary traces can be converted to the text layout
+   *        with BinaryTraceReader (e.g., using the ndn-trace-converter program)
    */
   static void
-  InstallAll(const std::string& file, Time averagingPeriod = Seconds(0.5));
+  InstallAll(const std::string& file, Time averagingPeriod = Seconds(0.5),
+             TraceFormat format = TraceFormat::TEXT);
 
   /**
    * @brief Helper method to install tracers on the selected simulation nodes
@@ -156,21 +160,36 @@ private:
   SetAveragingPeriod(const Time& period);
 
   void
-  PeriodicPrinter();
+  Write(TraceWriter& writer) const;
 
   void
   Reset();
 
-  void
-  AddInfo(const Face& face);
+  struct FaceStats {
+    // packets, bytes, smoothed packet rate, and smoothed byte rate
+    std::tuple<Stats, Stats, Stats, Stats> counters;
+    std::string info; // needed, because face may no longer exists at the time of stat printing
+    bool isUsed = false;
+  };
+
+  /**
+   * @brief Get counters of the face, creating them on the first use
+   *
+   * Face IDs of a node are allocated sequentially after the reserved ones, so counters of
+   * regular faces are kept in a dense table indexed by the face ID.
+   */
+  FaceStats&
+  GetStats(const Face& face);
 
 private:
   shared_ptr<std::ostream> m_os;
+  shared_ptr<TraceWriter> m_writer; // binary writer shared by the tracers of the file, if any
   Time m_period;
-  EventId m_printEvent;
+  uint64_t m_printerId;
 
-  mutable std::map<nfd::FaceId, std::tuple<Stats, Stats, Stats, Stats>> m_stats;
-  std::map<nfd::FaceId, std::string> m_faceInfos; // needed, because face may no longer exists at the time of stat printing
+  mutable std::vector<FaceStats> m_stats; // regular faces, indexed by FaceId - FACEID_RESERVED_MAX - 1
+  mutable std::map<nfd::FaceId, FaceStats> m_reservedStats; // e.g., internal face (management)
+  mutable FaceStats m_totalStats;
 };
 
 } // namespace ndn
@@ -0,0 +1,226 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-mem-tracer.hpp"
+#include "tracer-scheduler.hpp"
+#include "ns3/node.h"
+#include "ns3/names.h"
+#include "ns3/simulator.h"
+#include "ns3/node-list.h"
+#include "ns3/log.h"
+
+#include "utils/mem-usage.hpp"
+#include "utils/table-mem-usage.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+#include <fstream>
+
+NS_LOG_COMPONENT_DEFINE("ndn.MemTracer");
+
+namespace ns3 {
+namespace ndn {
+
+static std::list<std::tuple<shared_ptr<std::ostream>, std::list<Ptr<MemTracer>>>> g_tracers;
+
+void
+MemTracer::Destroy()
+{
+  g_tracers.clear();
+}
+
+static const std::vector<TraceWriter::Column> COLUMNS = {
+  {"Time", TraceWriter::TIME},
+  {"Node", TraceWriter::STRING},
+  {"Table", TraceWriter::STRING},
+  {"Entries", TraceWriter::INTEGER},
+  {"Bytes", TraceWriter::INTEGER},
+};
+
+static shared_ptr<std::ostream>
+openOutputStream(const std::string& file, std::ios_base::openmode mode)
+{
+  if (file == "-") {
+    return shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+  }
+
+  shared_ptr<std::ofstream> os(new std::ofstream());
+  os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc | mode);
+  if (!os->is_open()) {
+    NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+    return nullptr;
+  }
+  return os;
+}
+
+void
+MemTracer::InstallAll(const std::string& file, Time period /* = Seconds (1.0)*/,
+                      TraceFormat format /* = TraceFormat::TEXT*/)
+{
+  shared_ptr<std::ostream> outputStream = openOutputStream(file, std::ios_base::binary);
+  if (outputStream == nullptr) {
+    return;
+  }
+
+  shared_ptr<TraceWriter> writer;
+  if (format != TraceFormat::TEXT) {
+    writer = make_shared<BinaryTraceWriter>(outputStream, COLUMNS,
+                                            format == TraceFormat::BINARY_COMPRESSED);
+  }
+
+  std::list<Ptr<MemTracer>> tracers;
+  // the process-wide row goes first, so per-table rows of the same tick can be compared to it
+  tracers.push_back(Install(nullptr, outputStream, period));
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    tracers.push_back(Install(*node, outputStream, period));
+  }
+  for (auto& tracer : tracers) {
+    tracer->m_writer = writer;
+  }
+
+  if (writer == nullptr) {
+    tracers.front()->PrintHeader(*outputStream);
+    *outputStream << "\n";
+  }
+
+  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+}
+
+void
+MemTracer::Install(const NodeContainer& nodes, const std::string& file,
+                   Time period /* = Seconds (1.0)*/)
+{
+  shared_ptr<std::ostream> outputStream = openOutputStream(file, std::ios_base::openmode());
+  if (outputStream == nullptr) {
+    return;
+  }
+
+  std::list<Ptr<MemTracer>> tracers;
+  for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
+    tracers.push_back(Install(*node, outputStream, period));
+  }
+
+  if (tracers.size() > 0) {
+    tracers.front()->PrintHeader(*outputStream);
+    *outputStream << "\n";
+  }
+
+  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+}
+
+Ptr<MemTracer>
+MemTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream,
+                   Time period /* = Seconds (1.0)*/)
+{
+  Ptr<MemTracer> trace = Create<MemTracer>(outputStream, node);
+  trace->SetPeriod(period);
+
+  return trace;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+MemTracer::MemTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
+  : m_node("all")
+  , m_nodePtr(node)
+  , m_os(os)
+  , m_printerId(0)
+{
+  if (m_nodePtr != nullptr) {
+    m_node = boost::lexical_cast<std::string>(m_nodePtr->GetId());
+
+    std::string name = Names::FindName(node);
+    if (!name.empty()) {
+      m_node = name;
+    }
+  }
+}
+
+MemTracer::~MemTracer()
+{
+  TracerScheduler::Remove(m_printerId);
+}
+
+void
+MemTracer::SetPeriod(const Time& period)
+{
+  m_period = period;
+  TracerScheduler::Remove(m_printerId);
+  m_printerId = TracerScheduler::Add(m_period, m_os, [this] (std::ostream& os) {
+      if (m_writer != nullptr) {
+        Write(*m_writer);
+      }
+      else {
+        Print(os);
+      }
+    });
+}
+
+void
+MemTracer::PrintHeader(std::ostream& os) const
+{
+  os << "Time"
+     << "\t"
+
+     << "Node"
+     << "\t"
+
+     << "Table"
+     << "\t"
+     << "Entries"
+     << "\t"
+     << "Bytes";
+}
+
+void
+MemTracer::Print(std::ostream& os) const
+{
+  TextTraceWriter writer(os);
+  Write(writer);
+}
+
+void
+MemTracer::Write(TraceWriter& writer) const
+{
+  Time time = Simulator::Now();
+
+  if (m_nodePtr == nullptr) {
+    writer.AddTime(time);
+    writer.AddString(m_node);
+    writer.AddString("Process");
+    writer.AddInteger(NodeList::GetNNodes());
+    writer.AddInteger(MemUsage::Get());
+    writer.EndRow();
+    return;
+  }
+
+  for (const auto& table : TableMemUsage::Get(m_nodePtr)) {
+    writer.AddTime(time);
+    writer.AddString(m_node);
+    writer.AddString(table.name);
+    writer.AddInteger(table.nEntries);
+    writer.AddInteger(table.nBytes);
+    writer.EndRow();
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
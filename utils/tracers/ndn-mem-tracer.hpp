@@ -0,0 +1,141 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_MEM_TRACER_H
+#define NDN_MEM_TRACER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "trace-writer.hpp"
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include <ns3/nstime.h>
+#include <ns3/node-container.h>
+
+#include <list>
+
+namespace ns3 {
+
+class Node;
+
+namespace ndn {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief NDN tracer for memory used by the forwarding tables
+ *
+ * Every period, the tracer writes one row per table of the node with the number of entries and
+ * the estimated number of bytes (see TableMemUsage).  Tracers installed with InstallAll also
+ * write a row with the resident size of the whole simulation process (node "all", table
+ * "Process", with the number of nodes in the Entries column), which accounts for the memory
+ * not attributed to the tables, e.g., ns-3 packets in flight and tracers.
+ */
+class MemTracer : public SimpleRefCount<MemTracer> {
+public:
+  /**
+   * @brief Helper method to install tracers on all simulation nodes
+   *
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param period How often data will be written into the trace file (default, every second)
+   * @param format Format of the trace file; binary traces can be converted to the text layout
+   *        with BinaryTraceReader (e.g., using the ndn-trace-converter program)
+   */
+  static void
+  InstallAll(const std::string& file, Time period = Seconds(1.0),
+             TraceFormat format = TraceFormat::TEXT);
+
+  /**
+   * @brief Helper method to install tracers on the selected simulation nodes
+   *
+   * @param nodes Nodes on which to install tracer
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param period How often data will be written into the trace file (default, every second)
+   */
+  static void
+  Install(const NodeContainer& nodes, const std::string& file, Time period = Seconds(1.0));
+
+  /**
+   * @brief Helper method to install tracers on a specific simulation node
+   *
+   * @param node Node on which to install tracer
+   * @param outputStream Smart pointer to a stream
+   * @param period How often data will be written into the trace file (default, every second)
+   */
+  static Ptr<MemTracer>
+  Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream, Time period = Seconds(1.0));
+
+  /**
+   * @brief Explicit request to remove all statically created tracers
+   *
+   * This method can be helpful if simulation scenario contains several independent run,
+   * or if it is desired to do a postprocessing of the resulting data
+   */
+  static void
+  Destroy();
+
+  /**
+   * @brief Trace constructor that attaches to the node using node pointer
+   * @param os    reference to the output stream
+   * @param node  pointer to the node, or nullptr to trace memory used by the whole process
+   */
+  MemTracer(shared_ptr<std::ostream> os, Ptr<Node> node);
+
+  /**
+   * @brief Destructor
+   */
+  ~MemTracer();
+
+  /**
+   * @brief Print head of the trace (e.g., for post-processing)
+   *
+   * @param os reference to output stream
+   */
+  void
+  PrintHeader(std::ostream& os) const;
+
+  /**
+   * @brief Print current trace data
+   *
+   * @param os reference to output stream
+   */
+  void
+  Print(std::ostream& os) const;
+
+private:
+  void
+  SetPeriod(const Time& period);
+
+  void
+  Write(TraceWriter& writer) const;
+
+private:
+  std::string m_node;
+  Ptr<Node> m_nodePtr;
+
+  shared_ptr<std::ostream> m_os;
+  shared_ptr<TraceWriter> m_writer; // binary writer shared by the tracers of the file, if any
+
+  Time m_period;
+  uint64_t m_printerId;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_MEM_TRACER_H
@@ -0,0 +1,226 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "threaded-trace-writer.hpp"
+
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cstring>
+
+NS_LOG_COMPONENT_DEFINE("ThreadedTraceWriter");
+
+namespace ns3 {
+
+ThreadedTraceWriter::ThreadedTraceWriter(std::unique_ptr<TraceWriter> target,
+                                         std::shared_ptr<std::ostream> os,
+                                         size_t capacity /* = 65536*/)
+  : m_target(std::move(target))
+  , m_os(std::move(os))
+  , m_head(0)
+  , m_knownTail(0)
+  , m_nOverflows(0)
+  , m_blockedTime(0)
+  , m_newStringLength(0)
+  , m_publishedHead(0)
+  , m_tail(0)
+  , m_isStopped(false)
+{
+  size_t size = 2;
+  while (size < capacity) {
+    size *= 2;
+  }
+  m_ring.resize(size);
+  m_mask = size - 1;
+
+  m_thread = std::thread(&ThreadedTraceWriter::Run, this);
+}
+
+ThreadedTraceWriter::~ThreadedTraceWriter()
+{
+  Publish();
+  m_isStopped.store(true, std::memory_order_release);
+  WakeUp();
+  m_thread.join();
+
+  m_target.reset(); // writes buffered rows, if any
+  m_os->flush();
+
+  if (m_nOverflows > 0) {
+    NS_LOG_WARN("Trace ring buffer was full " << m_nOverflows << " times, simulation waited for "
+                << std::chrono::duration<double>(m_blockedTime).count() << " seconds");
+  }
+}
+
+void
+ThreadedTraceWriter::Push(RecordType type, uint64_t value)
+{
+  if (m_head - m_knownTail == m_ring.size()) {
+    m_knownTail = m_tail.load(std::memory_order_acquire);
+    if (m_head - m_knownTail == m_ring.size()) {
+      ++m_nOverflows;
+      Publish(); // let the I/O thread drain the partial row
+      WakeUp();
+      auto begin = std::chrono::steady_clock::now();
+      do {
+        std::this_thread::yield();
+        m_knownTail = m_tail.load(std::memory_order_acquire);
+      } while (m_head - m_knownTail == m_ring.size());
+      m_blockedTime += std::chrono::steady_clock::now() - begin;
+    }
+  }
+
+  m_ring[m_head & m_mask] = Record{value, type};
+  ++m_head;
+}
+
+void
+ThreadedTraceWriter::Publish()
+{
+  m_publishedHead.store(m_head, std::memory_order_release);
+}
+
+void
+ThreadedTraceWriter::WakeUp()
+{
+  {
+    // the I/O thread either has not checked the condition yet or is already waiting
+    std::lock_guard<std::mutex> lock(m_mutex);
+  }
+  m_wakeup.notify_one();
+}
+
+void
+ThreadedTraceWriter::AddTime(const Time& time)
+{
+  Push(TIME_RECORD, time.GetTimeStep());
+}
+
+void
+ThreadedTraceWriter::AddString(const std::string& value)
+{
+  auto entry = m_strings.emplace(value, m_strings.size());
+  if (entry.second) {
+    Push(NEW_STRING, value.size());
+    for (size_t offset = 0; offset < value.size(); offset += 8) {
+      uint64_t bytes = 0;
+      std::memcpy(&bytes, value.data() + offset, std::min<size_t>(8, value.size() - offset));
+      Push(BYTES, bytes);
+    }
+  }
+  Push(STRING_RECORD, entry.first->second);
+}
+
+void
+ThreadedTraceWriter::AddInteger(int64_t value)
+{
+  Push(INTEGER_RECORD, value);
+}
+
+void
+ThreadedTraceWriter::AddReal(double value)
+{
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  Push(REAL_RECORD, bits);
+}
+
+void
+ThreadedTraceWriter::EndRow()
+{
+  Push(END_ROW, 0);
+  Publish();
+}
+
+void
+ThreadedTraceWriter::Run()
+{
+  size_t tail = 0;
+  size_t nIdlePolls = 0;
+  while (true) {
+    size_t head = m_publishedHead.load(std::memory_order_acquire);
+    if (head == tail) {
+      if (m_isStopped.load(std::memory_order_acquire)) {
+        if (m_publishedHead.load(std::memory_order_acquire) == tail) {
+          break;
+        }
+        continue;
+      }
+      // stay responsive during bursts, but do not keep a core busy when the simulation is idle
+      if (++nIdlePolls < MAX_IDLE_POLLS) {
+        std::this_thread::yield();
+      }
+      else {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_wakeup.wait_for(lock, std::chrono::milliseconds(1), [this, tail] {
+            return m_publishedHead.load(std::memory_order_acquire) != tail ||
+                   m_isStopped.load(std::memory_order_acquire);
+          });
+      }
+      continue;
+    }
+    nIdlePolls = 0;
+
+    for (; tail != head; ++tail) {
+      Replay(m_ring[tail & m_mask]);
+    }
+    m_tail.store(tail, std::memory_order_release);
+  }
+}
+
+void
+ThreadedTraceWriter::Replay(const Record& record)
+{
+  switch (record.type) {
+  case TIME_RECORD:
+    m_target->AddTime(TimeStep(record.value));
+    break;
+  case STRING_RECORD:
+    m_target->AddString(m_dictionary[record.value]);
+    break;
+  case INTEGER_RECORD:
+    m_target->AddInteger(static_cast<int64_t>(record.value));
+    break;
+  case REAL_RECORD: {
+    double value;
+    std::memcpy(&value, &record.value, sizeof(value));
+    m_target->AddReal(value);
+    break;
+  }
+  case NEW_STRING:
+    m_newString.clear();
+    m_newStringLength = record.value;
+    if (m_newStringLength == 0) {
+      m_dictionary.push_back(m_newString);
+    }
+    break;
+  case BYTES:
+    m_newString.append(reinterpret_cast<const char*>(&record.value),
+                       std::min<size_t>(8, m_newStringLength - m_newString.size()));
+    if (m_newString.size() == m_newStringLength) {
+      m_dictionary.push_back(m_newString);
+    }
+    break;
+  case END_ROW:
+    m_target->EndRow();
+    break;
+  }
+}
+
+} // namespace ns3
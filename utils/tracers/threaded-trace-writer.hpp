@@ -0,0 +1,160 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef THREADED_TRACE_WRITER_H
+#define THREADED_TRACE_WRITER_H
+
+#include "trace-writer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace ns3 {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Trace writer that formats and writes rows on a dedicated I/O thread
+ *
+ * Fields are encoded as compact fixed-size records (strings are replaced with indices, and
+ * each string is sent only the first time it is used) and pushed into a lock-free
+ * single-producer single-consumer ring buffer.  The I/O thread drains the ring into @p target,
+ * so the simulation thread neither formats rows nor blocks on the disk.
+ *
+ * If the ring is full, the simulation thread waits until the I/O thread frees some space, so
+ * no rows are lost; the number of such waits and their total duration are accounted and
+ * reported when the writer is destroyed.
+ *
+ * All Add* and EndRow calls must be made from the same thread.
+ */
+class ThreadedTraceWriter : public TraceWriter {
+public:
+  /**
+   * @param target writer used by the I/O thread
+   * @param os stream that @p target writes to; it is kept alive and flushed by this writer
+   * @param capacity capacity of the ring, in records (rounded up to a power of two)
+   */
+  ThreadedTraceWriter(std::unique_ptr<TraceWriter> target, std::shared_ptr<std::ostream> os,
+                      size_t capacity = 65536);
+
+  /**
+   * @brief Write all pushed rows and stop the I/O thread
+   */
+  ~ThreadedTraceWriter();
+
+  void
+  AddTime(const Time& time) override;
+
+  void
+  AddString(const std::string& value) override;
+
+  void
+  AddInteger(int64_t value) override;
+
+  void
+  AddReal(double value) override;
+
+  void
+  EndRow() override;
+
+  /**
+   * @brief Number of times the simulation thread found the ring full
+   */
+  uint64_t
+  GetNOverflows() const
+  {
+    return m_nOverflows;
+  }
+
+  /**
+   * @brief Total time the simulation thread waited for the I/O thread
+   */
+  std::chrono::steady_clock::duration
+  GetBlockedTime() const
+  {
+    return m_blockedTime;
+  }
+
+private:
+  static const size_t MAX_IDLE_POLLS = 1000;
+
+  enum RecordType : uint8_t {
+    TIME_RECORD,
+    STRING_RECORD,  // value: index of the string
+    INTEGER_RECORD,
+    REAL_RECORD,
+    NEW_STRING,     // value: length; followed by the bytes of the string in BYTES records
+    BYTES,          // value: up to 8 bytes of a new string
+    END_ROW
+  };
+
+  struct Record {
+    uint64_t value;
+    RecordType type;
+  };
+
+  void
+  Push(RecordType type, uint64_t value);
+
+  void
+  Publish();
+
+  void
+  WakeUp();
+
+  void
+  Run();
+
+  void
+  Replay(const Record& record);
+
+private:
+  std::unique_ptr<TraceWriter> m_target;
+  std::shared_ptr<std::ostream> m_os;
+
+  std::vector<Record> m_ring;
+  size_t m_mask;
+
+  // producer (simulation thread)
+  size_t m_head;
+  size_t m_knownTail;
+  std::unordered_map<std::string, uint32_t> m_strings;
+  uint64_t m_nOverflows;
+  std::chrono::steady_clock::duration m_blockedTime;
+
+  // consumer (I/O thread)
+  std::vector<std::string> m_dictionary;
+  std::string m_newString;
+  size_t m_newStringLength;
+
+  alignas(64) std::atomic<size_t> m_publishedHead;
+  alignas(64) std::atomic<size_t> m_tail;
+  std::atomic<bool> m_isStopped;
+
+  // the idle I/O thread sleeps until new rows are published, the ring is full, or destruction
+  std::mutex m_mutex;
+  std::condition_variable m_wakeup;
+  std::thread m_thread;
+};
+
+} // namespace ns3
+
+#endif // THREADED_TRACE_WRITER_H
@@ -0,0 +1,217 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "trace-writer.hpp"
+
+#include "ns3/assert.h"
+
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+
+#include <cstring>
+
+namespace ns3 {
+
+namespace io = boost::iostreams;
+
+namespace {
+
+void
+appendNumber(std::string& buffer, uint64_t value, size_t size)
+{
+  for (size_t i = 0; i < size; ++i) {
+    buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+  }
+}
+
+} // namespace
+
+TextTraceWriter::TextTraceWriter(std::ostream& os)
+  : m_os(os)
+  , m_isRowStarted(false)
+{
+}
+
+void
+TextTraceWriter::Separate()
+{
+  if (m_isRowStarted) {
+    m_os << "\t";
+  }
+  m_isRowStarted = true;
+}
+
+void
+TextTraceWriter::AddTime(const Time& time)
+{
+  Separate();
+  m_os << time.ToDouble(Time::S);
+}
+
+void
+TextTraceWriter::AddString(const std::string& value)
+{
+  Separate();
+  m_os << value;
+}
+
+void
+TextTraceWriter::AddInteger(int64_t value)
+{
+  Separate();
+  m_os << value;
+}
+
+void
+TextTraceWriter::AddReal(double value)
+{
+  Separate();
+  m_os << value;
+}
+
+void
+TextTraceWriter::EndRow()
+{
+  m_os << "\n";
+  m_isRowStarted = false;
+}
+
+BinaryTraceWriter::BinaryTraceWriter(std::shared_ptr<std::ostream> os,
+                                     const std::vector<Column>& columns, bool isCompressed,
+                                     uint32_t rowsPerChunk /* = 4096*/)
+  : m_os(std::move(os))
+  , m_columns(columns)
+  , m_isCompressed(isCompressed)
+  , m_rowsPerChunk(rowsPerChunk)
+  , m_values(columns.size())
+  , m_column(0)
+  , m_nRows(0)
+  , m_nNewStrings(0)
+{
+  NS_ASSERT(!m_columns.empty() && m_rowsPerChunk > 0);
+
+  std::string header = "NDNTRACE";
+  appendNumber(header, VERSION, 4);
+  appendNumber(header, Time::FromInteger(1, Time::S).GetTimeStep(), 8);
+  appendNumber(header, m_columns.size(), 4);
+  for (const auto& column : m_columns) {
+    appendNumber(header, column.type, 1);
+    appendNumber(header, column.name.size(), 4);
+    header += column.name;
+  }
+  m_os->write(header.data(), header.size());
+}
+
+BinaryTraceWriter::~BinaryTraceWriter()
+{
+  Flush();
+  m_os->flush();
+}
+
+void
+BinaryTraceWriter::AddValue(ColumnType type, uint64_t value, size_t size)
+{
+  NS_ASSERT_MSG(m_column < m_columns.size() && m_columns[m_column].type == type,
+                "Field does not match column " << m_column);
+  appendNumber(m_values[m_column++], value, size);
+}
+
+void
+BinaryTraceWriter::AddTime(const Time& time)
+{
+  AddValue(TIME, time.GetTimeStep(), 8);
+}
+
+void
+BinaryTraceWriter::AddString(const std::string& value)
+{
+  auto entry = m_dictionary.emplace(value, m_dictionary.size());
+  if (entry.second) {
+    appendNumber(m_newStrings, value.size(), 4);
+    m_newStrings += value;
+    ++m_nNewStrings;
+  }
+  AddValue(STRING, entry.first->second, 4);
+}
+
+void
+BinaryTraceWriter::AddInteger(int64_t value)
+{
+  AddValue(INTEGER, value, 8);
+}
+
+void
+BinaryTraceWriter::AddReal(double value)
+{
+  uint64_t bits;
+  static_assert(sizeof(bits) == sizeof(value), "double is expected to take 8 bytes");
+  std::memcpy(&bits, &value, sizeof(bits));
+  AddValue(REAL, bits, 8);
+}
+
+void
+BinaryTraceWriter::EndRow()
+{
+  NS_ASSERT_MSG(m_column == m_columns.size(), "Row has " << m_column << " fields instead of "
+                                                         << m_columns.size());
+  m_column = 0;
+  if (++m_nRows == m_rowsPerChunk) {
+    Flush();
+  }
+}
+
+void
+BinaryTraceWriter::Flush()
+{
+  if (m_nRows == 0) {
+    return;
+  }
+
+  std::string payload;
+  appendNumber(payload, m_nRows, 4);
+  appendNumber(payload, m_nNewStrings, 4);
+  payload += m_newStrings;
+  for (auto& values : m_values) {
+    payload += values;
+    values.clear();
+  }
+  m_newStrings.clear();
+  m_nNewStrings = 0;
+  m_nRows = 0;
+
+  std::string stored;
+  if (m_isCompressed) {
+    io::filtering_ostream compressor;
+    compressor.push(io::zlib_compressor());
+    compressor.push(io::back_inserter(stored));
+    compressor.write(payload.data(), payload.size());
+    compressor.reset(); // flushes the compressor into stored
+  }
+
+  const std::string& data = m_isCompressed ? stored : payload;
+  std::string header;
+  appendNumber(header, m_isCompressed ? 1 : 0, 1);
+  appendNumber(header, payload.size(), 4);
+  appendNumber(header, data.size(), 4);
+  m_os->write(header.data(), header.size());
+  m_os->write(data.data(), data.size());
+}
+
+} // namespace ns3
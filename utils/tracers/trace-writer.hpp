@@ -0,0 +1,186 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef TRACE_WRITER_H
+#define TRACE_WRITER_H
+
+#include "ns3/nstime.h"
+
+#include <boost/noncopyable.hpp>
+
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Format of the trace files
+ */
+enum class TraceFormat {
+  TEXT,             ///< tab-separated text, one row per line
+  BINARY,           ///< binary columnar chunks (see BinaryTraceWriter)
+  BINARY_COMPRESSED ///< binary columnar chunks compressed with zlib
+};
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Sink for rows of a trace
+ *
+ * Tracers describe each row as a sequence of typed fields followed by EndRow, so the same code
+ * produces both the text and the binary traces.
+ */
+class TraceWriter : boost::noncopyable {
+public:
+  enum ColumnType : uint8_t {
+    TIME = 0,    ///< simulation time, rendered in seconds
+    STRING = 1,  ///< node names, face descriptions, row types, ...
+    INTEGER = 2, ///< signed integer
+    REAL = 3     ///< double
+  };
+
+  struct Column {
+    std::string name;
+    ColumnType type;
+  };
+
+  virtual ~TraceWriter() = default;
+
+  virtual void
+  AddTime(const Time& time) = 0;
+
+  virtual void
+  AddString(const std::string& value) = 0;
+
+  virtual void
+  AddInteger(int64_t value) = 0;
+
+  virtual void
+  AddReal(double value) = 0;
+
+  virtual void
+  EndRow() = 0;
+};
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Trace writer that produces tab-separated text
+ */
+class TextTraceWriter : public TraceWriter {
+public:
+  explicit TextTraceWriter(std::ostream& os);
+
+  void
+  AddTime(const Time& time) override;
+
+  void
+  AddString(const std::string& value) override;
+
+  void
+  AddInteger(int64_t value) override;
+
+  void
+  AddReal(double value) override;
+
+  void
+  EndRow() override;
+
+private:
+  void
+  Separate();
+
+private:
+  std::ostream& m_os;
+  bool m_isRowStarted;
+};
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Trace writer that produces binary columnar chunks
+ *
+ * Rows are buffered column by column and written as a chunk every @p rowsPerChunk rows (and on
+ * Flush or destruction).  Strings are replaced with indices in a dictionary, new entries of
+ * which are carried by the chunk in which they are first used.  All numbers are little-endian:
+ *
+ *     file    := "NDNTRACE" version:u32 timeStepsPerSecond:u64 nColumns:u32 column*  chunk*
+ *     column  := type:u8 nameLength:u32 name
+ *     chunk   := flags:u8 (1 = zlib) payloadSize:u32 storedSize:u32 stored-payload
+ *     payload := nRows:u32 nNewStrings:u32 (length:u32 string)*  values-of-column*
+ *
+ * where TIME (in time steps), INTEGER and REAL (IEEE 754) values take 8 bytes and STRING
+ * values (dictionary indices) take 4 bytes.  BinaryTraceReader renders such files as text.
+ */
+class BinaryTraceWriter : public TraceWriter {
+public:
+  static const uint32_t VERSION = 1;
+
+  BinaryTraceWriter(std::shared_ptr<std::ostream> os, const std::vector<Column>& columns,
+                    bool isCompressed, uint32_t rowsPerChunk = 4096);
+
+  /**
+   * @brief Write buffered rows and destroy the writer
+   */
+  ~BinaryTraceWriter();
+
+  void
+  AddTime(const Time& time) override;
+
+  void
+  AddString(const std::string& value) override;
+
+  void
+  AddInteger(int64_t value) override;
+
+  void
+  AddReal(double value) override;
+
+  void
+  EndRow() override;
+
+  /**
+   * @brief Write buffered rows as a chunk
+   */
+  void
+  Flush();
+
+private:
+  void
+  AddValue(ColumnType type, uint64_t value, size_t size);
+
+private:
+  std::shared_ptr<std::ostream> m_os;
+  std::vector<Column> m_columns;
+  bool m_isCompressed;
+  uint32_t m_rowsPerChunk;
+
+  std::vector<std::string> m_values; // per column
+  size_t m_column;
+  uint32_t m_nRows;
+
+  std::unordered_map<std::string, uint32_t> m_dictionary;
+  std::string m_newStrings;
+  uint32_t m_nNewStrings;
+};
+
+} // namespace ns3
+
+#endif // TRACE_WRITER_H
@@ -0,0 +1,154 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "tracer-scheduler.hpp"
+
+#include "ns3/simulator.h"
+#include "ns3/event-id.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <sstream>
+#include <unordered_map>
+
+NS_LOG_COMPONENT_DEFINE("TracerScheduler");
+
+namespace ns3 {
+
+namespace {
+
+struct Registration {
+  std::shared_ptr<std::ostream> os;
+  TracerScheduler::Printer printer;
+};
+
+/**
+ * @brief Printers that are called from the same event
+ */
+struct Tick {
+  Time period;
+  Time next;
+  EventId event;
+  std::map<uint64_t, Registration> registrations; // ordered by registration
+};
+
+struct State {
+  std::list<Tick> ticks;
+  std::unordered_map<uint64_t, std::list<Tick>::iterator> index;
+  uint64_t lastId = 0;
+  bool isClearScheduled = false;
+};
+
+// Tracers are usually kept in static lists and unregister from their destructors, possibly
+// after static objects of this file have been destroyed; the state is therefore never freed
+State&
+getState()
+{
+  static State* state = new State;
+  return *state;
+}
+
+void
+clear()
+{
+  // called on Simulator::Destroy, when all scheduled events are gone
+  State& state = getState();
+  state.ticks.clear();
+  state.index.clear();
+  state.isClearScheduled = false;
+}
+
+void
+writeBlock(std::ostream* os, std::ostringstream& buffer)
+{
+  if (os != nullptr) {
+    *os << buffer.str();
+    buffer.str("");
+  }
+}
+
+void
+onTick(std::list<Tick>::iterator tick)
+{
+  std::ostringstream buffer;
+  std::ostream* os = nullptr;
+  for (auto& item : tick->registrations) {
+    if (item.second.os.get() != os) {
+      writeBlock(os, buffer);
+      os = item.second.os.get();
+      buffer.copyfmt(*os);
+    }
+    item.second.printer(buffer);
+  }
+  writeBlock(os, buffer);
+
+  tick->next += tick->period;
+  tick->event = Simulator::Schedule(tick->period, &onTick, tick);
+}
+
+} // namespace
+
+uint64_t
+TracerScheduler::Add(const Time& period, std::shared_ptr<std::ostream> os, const Printer& printer)
+{
+  State& state = getState();
+  if (!state.isClearScheduled) {
+    Simulator::ScheduleDestroy(&clear);
+    state.isClearScheduled = true;
+  }
+
+  Time next = Simulator::Now() + period;
+  auto tick = std::find_if(state.ticks.begin(), state.ticks.end(), [&] (const Tick& item) {
+      return item.period == period && item.next == next;
+    });
+  if (tick == state.ticks.end()) {
+    NS_LOG_DEBUG("New tick every " << period << " starting at " << next);
+    tick = state.ticks.emplace(state.ticks.end());
+    tick->period = period;
+    tick->next = next;
+    tick->event = Simulator::Schedule(period, &onTick, tick);
+  }
+
+  uint64_t id = ++state.lastId;
+  tick->registrations.emplace(id, Registration{std::move(os), printer});
+  state.index.emplace(id, tick);
+  return id;
+}
+
+void
+TracerScheduler::Remove(uint64_t id)
+{
+  State& state = getState();
+  auto i = state.index.find(id);
+  if (i == state.index.end()) {
+    return;
+  }
+
+  auto tick = i->second;
+  state.index.erase(i);
+  tick->registrations.erase(id);
+  if (tick->registrations.empty()) {
+    tick->event.Cancel();
+    state.ticks.erase(tick);
+  }
+}
+
+} // namespace ns3
@@ -0,0 +1,65 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef TRACER_SCHEDULER_H
+#define TRACER_SCHEDULER_H
+
+#include "ns3/nstime.h"
+
+#include <functional>
+#include <memory>
+#include <ostream>
+
+namespace ns3 {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Shared periodic tick for the rate tracers
+ *
+ * Instead of scheduling one simulator event per tracer, periodic tracers register their
+ * printers here.  All printers with the same period and phase are called from a single event,
+ * in the order of registration, and the output of consecutive printers writing to the same
+ * stream is buffered and written to it as one block per tick.
+ */
+class TracerScheduler {
+public:
+  /**
+   * @brief Printer that writes the current trace data to the stream and resets the counters
+   */
+  typedef std::function<void(std::ostream&)> Printer;
+
+  /**
+   * @brief Call @p printer with @p os every @p period, starting @p period from now
+   * @returns identifier of the registration, to be passed to Remove
+   */
+  static uint64_t
+  Add(const Time& period, std::shared_ptr<std::ostream> os, const Printer& printer);
+
+  /**
+   * @brief Stop calling the printer registered with @p id
+   *
+   * Unknown identifiers (e.g., of registrations dropped by Simulator::Destroy) are ignored.
+   */
+  static void
+  Remove(uint64_t id);
+};
+
+} // namespace ns3
+
+#endif // TRACER_SCHEDULER_H
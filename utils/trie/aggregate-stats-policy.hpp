@@ -103,6 +103,17 @@ struct aggregate_stats_policy_traits {
         return 0;
       }
 
+      inline void
+      set_max_bytes(size_t)
+      {
+      }
+
+      inline size_t
+      get_max_bytes() const
+      {
+        return 0;
+      }
+
       inline void
       clear()
       {
@@ -0,0 +1,124 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+#ifndef BYTE_LIMIT_H_
+#define BYTE_LIMIT_H_
+
+/// @cond include_hidden
+
+#include "payload-bytes.hpp"
+
+#include <cstddef>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+namespace detail {
+
+/**
+ * @brief Byte limit shared by the evicting policies
+ *
+ * Keeps the total bytes of the entries in a policy (see payload_bytes) and the limit on them.
+ * The policy charges entries on insert and erase, and evicts entries in its own replacement
+ * order through make_room.
+ */
+class byte_limit {
+public:
+  byte_limit()
+    : max_bytes_(0)
+    , bytes_(0)
+  {
+  }
+
+  inline void
+  set_max_bytes(size_t max_bytes)
+  {
+    max_bytes_ = max_bytes;
+  }
+
+  inline size_t
+  get_max_bytes() const
+  {
+    return max_bytes_;
+  }
+
+  inline size_t
+  get_bytes() const
+  {
+    return bytes_;
+  }
+
+protected:
+  /**
+   * @brief Check whether an entry of @p bytes can fit at all
+   */
+  inline bool
+  fits(size_t bytes) const
+  {
+    return max_bytes_ == 0 || bytes <= max_bytes_;
+  }
+
+  /**
+   * @brief Evict entries until an entry of @p bytes fits
+   * @param evict erases the next entry in replacement order and returns true, or returns false
+   *        if the new entry should not be inserted instead
+   * @return whether the new entry can be inserted
+   */
+  template<class Evict>
+  inline bool
+  make_room(size_t bytes, Evict evict)
+  {
+    while (max_bytes_ != 0 && bytes_ + bytes > max_bytes_ && bytes_ > 0) {
+      if (!evict()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  inline void
+  charge(size_t bytes)
+  {
+    bytes_ += bytes;
+  }
+
+  inline void
+  discharge(size_t bytes)
+  {
+    bytes_ -= bytes;
+  }
+
+  inline void
+  reset_bytes()
+  {
+    bytes_ = 0;
+  }
+
+private:
+  size_t max_bytes_; ///< @brief byte limit, 0 if not enforced
+  size_t bytes_;     ///< @brief total bytes of entries in the policy
+};
+
+} // detail
+} // ndnSIM
+} // ndn
+} // ns3
+
+/// @endcond
+
+#endif // BYTE_LIMIT_H_
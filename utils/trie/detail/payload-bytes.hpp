@@ -0,0 +1,66 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef PAYLOAD_BYTES_H_
+#define PAYLOAD_BYTES_H_
+
+/// @cond include_hidden
+
+#include <cstddef>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+namespace detail {
+
+template<class Iterator>
+inline auto
+payload_bytes_impl(Iterator item, int) -> decltype(item->payload()->GetData()->wireEncode().size())
+{
+  return item->payload()->GetData()->wireEncode().size();
+}
+
+template<class Iterator>
+inline size_t
+payload_bytes_impl(Iterator item, long)
+{
+  return 0;
+}
+
+/**
+ * @brief Number of bytes a trie node is charged against the byte limit of a policy
+ *
+ * For content store entries, the node is charged with the size of the wire encoding of the
+ * cached Data.  Other payloads are not charged, i.e., byte limits have no effect on them.
+ */
+template<class Iterator>
+inline size_t
+payload_bytes(Iterator item)
+{
+  return payload_bytes_impl(item, 0);
+}
+
+} // detail
+} // ndnSIM
+} // ndn
+} // ns3
+
+/// @endcond
+
+#endif // PAYLOAD_BYTES_H_
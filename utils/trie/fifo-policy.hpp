@@ -22,6 +22,8 @@
 
 /// @cond include_hidden
 
+#include "detail/byte-limit.hpp"
+
 #include <boost/intrusive/options.hpp>
 #include <boost/intrusive/list.hpp>
 
@@ -55,7 +57,7 @@ struct fifo_policy_traits {
     typedef typename boost::intrusive::list<Container, Hook> policy_container;
 
     // could be just typedef
-    class type : public policy_container {
+    class type : public policy_container, public detail::byte_limit {
     public:
       typedef Container parent_trie;
 
@@ -74,11 +76,22 @@ struct fifo_policy_traits {
       inline bool
       insert(typename parent_trie::iterator item)
       {
+        size_t bytes = detail::payload_bytes(item);
+        if (!fits(bytes)) {
+          return false;
+        }
+
         if (max_size_ != 0 && policy_container::size() >= max_size_) {
           base_.erase(&(*policy_container::begin()));
         }
 
+        make_room(bytes, [this] {
+            base_.erase(&(*policy_container::begin()));
+            return true;
+          });
+
         policy_container::push_back(*item);
+        charge(bytes);
         return true;
       }
 
@@ -91,6 +104,7 @@ struct fifo_policy_traits {
       inline void
       erase(typename parent_trie::iterator item)
       {
+        discharge(detail::payload_bytes(item));
         policy_container::erase(policy_container::s_iterator_to(*item));
       }
 
@@ -98,6 +112,7 @@ struct fifo_policy_traits {
       clear()
       {
         policy_container::clear();
+        reset_bytes();
       }
 
       inline void
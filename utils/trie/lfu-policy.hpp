@@ -22,6 +22,8 @@
 
 /// @cond include_hidden
 
+#include "detail/byte-limit.hpp"
+
 #include <boost/intrusive/options.hpp>
 #include <boost/intrusive/set.hpp>
 
@@ -80,7 +82,7 @@ struct lfu_policy_traits {
                                        Hook> policy_container;
 
     // could be just typedef
-    class type : public policy_container {
+    class type : public policy_container, public detail::byte_limit {
     public:
       typedef policy policy_base; // to get access to get_order methods from outside
       typedef Container parent_trie;
@@ -104,12 +106,23 @@ struct lfu_policy_traits {
       {
         get_order(item) = 0;
 
+        size_t bytes = detail::payload_bytes(item);
+        if (!fits(bytes)) {
+          return false;
+        }
+
         if (max_size_ != 0 && policy_container::size() >= max_size_) {
           // this erases the "least frequently used item" from cache
           base_.erase(&(*policy_container::begin()));
         }
 
+        make_room(bytes, [this] {
+            base_.erase(&(*policy_container::begin()));
+            return true;
+          });
+
         policy_container::insert(*item);
+        charge(bytes);
         return true;
       }
 
@@ -124,6 +137,7 @@ struct lfu_policy_traits {
       inline void
       erase(typename parent_trie::iterator item)
       {
+        discharge(detail::payload_bytes(item));
         policy_container::erase(policy_container::s_iterator_to(*item));
       }
 
@@ -131,6 +145,7 @@ struct lfu_policy_traits {
       clear()
       {
         policy_container::clear();
+        reset_bytes();
       }
 
       inline void
@@ -0,0 +1,170 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef POOL_ALLOCATOR_H_
+#define POOL_ALLOCATOR_H_
+
+/// @cond include_hidden
+
+#include "trie.hpp"
+
+#include <boost/noncopyable.hpp>
+
+#include <map>
+#include <type_traits>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+/**
+ * @brief Allocate trie nodes and bucket arrays from per-trie pools
+ *
+ * Nodes are carved out of slabs of NODES_PER_SLAB nodes, and nodes and bucket arrays released
+ * by erase/prune/clear are kept on free lists and reused by subsequent inserts.  Memory is
+ * returned to the system only when the whole trie is destroyed, which makes this allocator a
+ * good fit for tries with heavy insert/erase churn (e.g., content stores), but not for tries
+ * that grow once and then shrink permanently.
+ *
+ * Usage: trie_with_policy<Name, PayloadTraits, lru_policy_traits, pool_allocator_traits>
+ */
+struct pool_allocator_traits {
+  template<typename Node, typename Bucket>
+  class allocator : boost::noncopyable {
+  public:
+    static const size_t NODES_PER_SLAB = 256;
+
+    allocator()
+      : nextInSlab_(NODES_PER_SLAB)
+      , nBucketBytes_(0)
+    {
+    }
+
+    ~allocator()
+    {
+      for (auto& sizeAndArrays : freeBuckets_) {
+        for (bucket_storage* array : sizeAndArrays.second) {
+          delete[] array;
+        }
+      }
+    }
+
+    template<typename... Args>
+    Node*
+    create_node(Args&&... args)
+    {
+      node_storage* memory = nullptr;
+      if (!freeNodes_.empty()) {
+        memory = freeNodes_.back();
+        freeNodes_.pop_back();
+      }
+      else {
+        if (nextInSlab_ == NODES_PER_SLAB) {
+          slabs_.emplace_back(new node_storage[NODES_PER_SLAB]);
+          nextInSlab_ = 0;
+        }
+        memory = &slabs_.back()[nextInSlab_++];
+      }
+
+      try {
+        return new (memory) Node(std::forward<Args>(args)...);
+      }
+      catch (...) {
+        freeNodes_.push_back(memory);
+        throw;
+      }
+    }
+
+    void
+    destroy_node(Node* node)
+    {
+      node->~Node();
+      freeNodes_.push_back(reinterpret_cast<node_storage*>(node));
+    }
+
+    Bucket*
+    allocate_buckets(size_t size)
+    {
+      bucket_storage* memory = nullptr;
+      std::vector<bucket_storage*>& freeArrays = freeBuckets_[size];
+      if (!freeArrays.empty()) {
+        memory = freeArrays.back();
+        freeArrays.pop_back();
+      }
+      else {
+        memory = new bucket_storage[size];
+        nBucketBytes_ += size * sizeof(bucket_storage);
+      }
+
+      Bucket* buckets = reinterpret_cast<Bucket*>(memory);
+      for (size_t i = 0; i < size; ++i) {
+        new (&buckets[i]) Bucket();
+      }
+      return buckets;
+    }
+
+    void
+    deallocate_buckets(Bucket* buckets, size_t size)
+    {
+      for (size_t i = 0; i < size; ++i) {
+        buckets[i].~Bucket();
+      }
+      freeBuckets_[size].push_back(reinterpret_cast<bucket_storage*>(buckets));
+    }
+
+    /**
+     * @brief Number of live nodes created by this allocator (the root node is not included)
+     */
+    size_t
+    get_n_nodes() const
+    {
+      return slabs_.size() * NODES_PER_SLAB - (NODES_PER_SLAB - nextInSlab_) - freeNodes_.size();
+    }
+
+    /**
+     * @brief Bytes reserved by the pools, including free nodes and bucket arrays kept for reuse
+     */
+    size_t
+    get_bytes() const
+    {
+      return slabs_.size() * NODES_PER_SLAB * sizeof(node_storage) + nBucketBytes_;
+    }
+
+  private:
+    typedef typename std::aligned_storage<sizeof(Node), alignof(Node)>::type node_storage;
+    typedef typename std::aligned_storage<sizeof(Bucket), alignof(Bucket)>::type bucket_storage;
+
+    std::vector<std::unique_ptr<node_storage[]>> slabs_;
+    size_t nextInSlab_;
+    std::vector<node_storage*> freeNodes_;
+
+    // bucket arrays grow geometrically, so there are only a few distinct sizes
+    std::map<size_t, std::vector<bucket_storage*>> freeBuckets_;
+    size_t nBucketBytes_;
+  };
+};
+
+} // ndnSIM
+} // ndn
+} // ns3
+
+/// @endcond
+
+#endif // POOL_ALLOCATOR_H_
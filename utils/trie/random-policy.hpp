@@ -25,6 +25,8 @@
 #include "ns3/random-variable-stream.h"
 #include "ns3/double.h"
 
+#include "detail/byte-limit.hpp"
+
 #include <boost/intrusive/options.hpp>
 #include <boost/intrusive/set.hpp>
 
@@ -83,7 +85,7 @@ struct random_policy_traits {
                                        Hook> policy_container;
 
     // could be just typedef
-    class type : public policy_container {
+    class type : public policy_container, public detail::byte_limit {
     public:
       typedef policy policy_base; // to get access to get_order methods from outside
       typedef Container parent_trie;
@@ -108,6 +110,11 @@ struct random_policy_traits {
       {
         get_order(item) = u_rand->GetValue();
 
+        size_t bytes = detail::payload_bytes(item);
+        if (!fits(bytes)) {
+          return false;
+        }
+
         if (max_size_ != 0 && policy_container::size() >= max_size_) {
           if (MemberHookLess<Container>()(*item, *policy_container::begin())) {
             // std::cout << "Cannot add. Signaling fail\n";
@@ -120,7 +127,19 @@ struct random_policy_traits {
           }
         }
 
+        bool hasRoom = make_room(bytes, [this, &item] {
+            if (MemberHookLess<Container>()(*item, *policy_container::begin())) {
+              return false; // the new item would be the next one to go
+            }
+            base_.erase(&(*policy_container::begin()));
+            return true;
+          });
+        if (!hasRoom) {
+          return false;
+        }
+
         policy_container::insert(*item);
+        charge(bytes);
         return true;
       }
 
@@ -133,6 +152,7 @@ struct random_policy_traits {
       inline void
       erase(typename parent_trie::iterator item)
       {
+        discharge(detail::payload_bytes(item));
         policy_container::erase(policy_container::s_iterator_to(*item));
       }
 
@@ -140,6 +160,7 @@ struct random_policy_traits {
       clear()
       {
         policy_container::clear();
+        reset_bytes();
       }
 
       inline void
@@ -24,20 +24,25 @@
 
 #include "trie.hpp"
 
+#include <unordered_map>
+
 namespace ns3 {
 namespace ndn {
 namespace ndnSIM {
 
-template<typename FullKey, typename PayloadTraits, typename PolicyTraits>
+template<typename FullKey, typename PayloadTraits, typename PolicyTraits,
+         typename AllocatorTraits = heap_allocator_traits>
 class trie_with_policy {
 public:
-  typedef trie<FullKey, PayloadTraits, typename PolicyTraits::policy_hook_type> parent_trie;
+  typedef trie<FullKey, PayloadTraits, typename PolicyTraits::policy_hook_type, AllocatorTraits>
+    parent_trie;
 
   typedef typename parent_trie::iterator iterator;
   typedef typename parent_trie::const_iterator const_iterator;
 
   typedef typename PolicyTraits::
-    template policy<trie_with_policy<FullKey, PayloadTraits, PolicyTraits>, parent_trie,
+    template policy<trie_with_policy<FullKey, PayloadTraits, PolicyTraits, AllocatorTraits>,
+                    parent_trie,
                     typename PolicyTraits::template container_hook<parent_trie>::type>::type
       policy_container;
 
@@ -50,7 +55,8 @@ public:
   inline std::pair<iterator, bool>
   insert(const FullKey& key, typename PayloadTraits::insert_type payload)
   {
-    std::pair<iterator, bool> item = trie_.insert(key, payload);
+    size_t fullHash = hash_key(key);
+    std::pair<iterator, bool> item = trie_.insert(key, hashes_, payload);
 
     if (item.second) // real insert
     {
@@ -59,6 +65,7 @@ public:
         item.first->erase(); // cannot insert
         return std::make_pair(end(), false);
       }
+      exact_.emplace(fullHash, item.first);
     }
     else {
       return std::make_pair(s_iterator_to(item.first), false);
@@ -70,14 +77,7 @@ public:
   inline void
   erase(const FullKey& key)
   {
-    iterator foundItem, lastItem;
-    bool reachLast;
-    std::tie(foundItem, reachLast, lastItem) = trie_.find(key);
-
-    if (!reachLast || lastItem->payload() == PayloadTraits::empty_payload)
-      return; // nothing to invalidate
-
-    erase(lastItem);
+    erase(find_exact_indexed(key, hash_key(key)));
   }
 
   inline void
@@ -87,6 +87,15 @@ public:
       return;
 
     policy_.erase(s_iterator_to(node));
+
+    auto range = exact_.equal_range(node->full_hash());
+    for (auto entry = range.first; entry != range.second; ++entry) {
+      if (entry->second == node) {
+        exact_.erase(entry);
+        break;
+      }
+    }
+
     node->erase(); // will do cleanup here
   }
 
@@ -94,6 +103,7 @@ public:
   clear()
   {
     policy_.clear();
+    exact_.clear();
     trie_.clear();
   }
 
@@ -117,14 +127,7 @@ public:
   inline iterator
   find_exact(const FullKey& key)
   {
-    iterator foundItem, lastItem;
-    bool reachLast;
-    std::tie(foundItem, reachLast, lastItem) = trie_.find(key);
-
-    if (!reachLast || lastItem->payload() == PayloadTraits::empty_payload)
-      return end();
-
-    return lastItem;
+    return find_exact_indexed(key, hash_key(key));
   }
 
   /**
@@ -133,9 +136,15 @@ public:
   inline iterator
   longest_prefix_match(const FullKey& key)
   {
-    iterator foundItem, lastItem;
+    iterator foundItem = find_exact_indexed(key, hash_key(key));
+    if (foundItem != end()) { // exact match is always the longest one
+      policy_.lookup(s_iterator_to(foundItem));
+      return foundItem;
+    }
+
+    iterator lastItem;
     bool reachLast;
-    std::tie(foundItem, reachLast, lastItem) = trie_.find(key);
+    std::tie(foundItem, reachLast, lastItem) = trie_.find(key, hashes_);
     if (foundItem != trie_.end()) {
       policy_.lookup(s_iterator_to(foundItem));
     }
@@ -149,9 +158,11 @@ public:
   inline iterator
   longest_prefix_match_if(const FullKey& key, Predicate pred)
   {
+    hash_key(key);
+
     iterator foundItem, lastItem;
     bool reachLast;
-    std::tie(foundItem, reachLast, lastItem) = trie_.find_if(key, pred);
+    std::tie(foundItem, reachLast, lastItem) = trie_.find_if(key, hashes_, pred);
     if (foundItem != trie_.end()) {
       policy_.lookup(s_iterator_to(foundItem));
     }
@@ -174,9 +185,15 @@ public:
   inline iterator
   deepest_prefix_match(const FullKey& key)
   {
-    iterator foundItem, lastItem;
+    iterator foundItem = find_exact_indexed(key, hash_key(key));
+    if (foundItem != end()) { // nothing can be deeper on the path than the exact match
+      policy_.lookup(s_iterator_to(foundItem));
+      return foundItem;
+    }
+
+    iterator lastItem;
     bool reachLast;
-    std::tie(foundItem, reachLast, lastItem) = trie_.find(key);
+    std::tie(foundItem, reachLast, lastItem) = trie_.find(key, hashes_);
 
     // guard in case we don't have anything in the trie
     if (lastItem == trie_.end())
@@ -201,9 +218,11 @@ public:
   inline iterator
   deepest_prefix_match_if(const FullKey& key, Predicate pred)
   {
+    hash_key(key);
+
     iterator foundItem, lastItem;
     bool reachLast;
-    std::tie(foundItem, reachLast, lastItem) = trie_.find(key);
+    std::tie(foundItem, reachLast, lastItem) = trie_.find(key, hashes_);
 
     // guard in case we don't have anything in the trie
     if (lastItem == trie_.end())
@@ -232,9 +251,11 @@ public:
   inline iterator
   deepest_prefix_match_if_next_level(const FullKey& key, Predicate pred)
   {
+    hash_key(key);
+
     iterator foundItem, lastItem;
     bool reachLast;
-    std::tie(foundItem, reachLast, lastItem) = trie_.find(key);
+    std::tie(foundItem, reachLast, lastItem) = trie_.find(key, hashes_);
 
     // guard in case we don't have anything in the trie
     if (lastItem == trie_.end())
@@ -283,6 +304,22 @@ public:
     return policy_;
   }
 
+  /**
+   * @brief Get the number of trie nodes (including the root) and the number of bytes allocated
+   *        for the nodes, their buckets, and the exact-match index
+   *
+   * Payloads themselves are not included
+   */
+  std::pair<size_t, size_t>
+  get_memory_usage() const
+  {
+    const auto& allocator = trie_.get_allocator();
+    size_t indexBytes = exact_.size() * (sizeof(typename exact_index::value_type) + 2 * sizeof(void*))
+                        + exact_.bucket_count() * sizeof(void*);
+    return std::make_pair(allocator.get_n_nodes() + 1,
+                          sizeof(trie_) + allocator.get_bytes() + indexBytes);
+  }
+
   static inline iterator
   s_iterator_to(typename parent_trie::iterator item)
   {
@@ -292,9 +329,57 @@ public:
       return &(*item);
   }
 
+private:
+  /**
+   * @brief Calculate hashes of key components into hashes_ and return hash of the full key
+   */
+  size_t
+  hash_key(const FullKey& key)
+  {
+    parent_trie::hash_components(key, hashes_);
+
+    size_t fullHash = 0;
+    for (size_t hash : hashes_) {
+      fullHash = parent_trie::combine_hash(fullHash, hash);
+    }
+    return fullHash;
+  }
+
+  /**
+   * @brief Find a node with payload and exactly the key through the full-key hash index
+   */
+  iterator
+  find_exact_indexed(const FullKey& key, size_t fullHash) const
+  {
+    auto range = exact_.equal_range(fullHash);
+    for (auto entry = range.first; entry != range.second; ++entry) {
+      if (entry->second->has_key(key)) {
+        return entry->second;
+      }
+    }
+    return end();
+  }
+
+  // full-key hashes are already well mixed, no need to hash them again
+  struct identity_hash {
+    size_t
+    operator()(size_t hash) const
+    {
+      return hash;
+    }
+  };
+
 private:
   parent_trie trie_;
   mutable policy_container policy_;
+
+  // index of all nodes with payload by hash of their full key, used to answer exact and
+  // deepest/longest prefix matches without walking the trie when the key itself is present
+  typedef std::unordered_multimap<size_t, iterator, identity_hash> exact_index;
+  exact_index exact_;
+
+  // hashes of components of the last looked up key, to hash each key only once per operation
+  std::vector<size_t> hashes_;
 };
 
 } // ndnSIM
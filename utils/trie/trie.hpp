@@ -34,6 +34,9 @@
 #include <tuple>
 #include <boost/foreach.hpp>
 #include <boost/mpl/if.hpp>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace ns3 {
 namespace ndn {
@@ -98,24 +101,100 @@ struct non_pointer_traits {
 template<typename Payload, typename BasePayload>
 Payload non_pointer_traits<Payload, BasePayload>::empty_payload = Payload();
 
+/////////////////////////////////////////////////////
+// Allow customization for node allocation
+//
+
+/**
+ * @brief Allocate every trie node and bucket array directly on the heap
+ *
+ * See pool_allocator_traits (pool-allocator.hpp) for the pooled alternative
+ */
+struct heap_allocator_traits {
+  template<typename Node, typename Bucket>
+  class allocator {
+  public:
+    allocator()
+      : nNodes_(0)
+      , nBucketBytes_(0)
+    {
+    }
+
+    template<typename... Args>
+    Node*
+    create_node(Args&&... args)
+    {
+      Node* node = new Node(std::forward<Args>(args)...);
+      ++nNodes_;
+      return node;
+    }
+
+    void
+    destroy_node(Node* node)
+    {
+      delete node;
+      --nNodes_;
+    }
+
+    Bucket*
+    allocate_buckets(size_t size)
+    {
+      Bucket* buckets = new Bucket[size];
+      nBucketBytes_ += size * sizeof(Bucket);
+      return buckets;
+    }
+
+    void
+    deallocate_buckets(Bucket* buckets, size_t size)
+    {
+      delete[] buckets;
+      nBucketBytes_ -= size * sizeof(Bucket);
+    }
+
+    /**
+     * @brief Number of live nodes created by this allocator (the root node is not included)
+     */
+    size_t
+    get_n_nodes() const
+    {
+      return nNodes_;
+    }
+
+    /**
+     * @brief Bytes currently allocated for nodes and bucket arrays
+     */
+    size_t
+    get_bytes() const
+    {
+      return nNodes_ * sizeof(Node) + nBucketBytes_;
+    }
+
+  private:
+    size_t nNodes_;
+    size_t nBucketBytes_;
+  };
+};
+
 ////////////////////////////////////////////////////
 // forward declarations
 //
-template<typename FullKey, typename PayloadTraits, typename PolicyHook>
+template<typename FullKey, typename PayloadTraits, typename PolicyHook,
+         typename AllocatorTraits = heap_allocator_traits>
 class trie;
 
-template<typename FullKey, typename PayloadTraits, typename PolicyHook>
+template<typename FullKey, typename PayloadTraits, typename PolicyHook, typename AllocatorTraits>
 inline std::ostream&
-operator<<(std::ostream& os, const trie<FullKey, PayloadTraits, PolicyHook>& trie_node);
+operator<<(std::ostream& os,
+           const trie<FullKey, PayloadTraits, PolicyHook, AllocatorTraits>& trie_node);
 
-template<typename FullKey, typename PayloadTraits, typename PolicyHook>
+template<typename FullKey, typename PayloadTraits, typename PolicyHook, typename AllocatorTraits>
 bool
-operator==(const trie<FullKey, PayloadTraits, PolicyHook>& a,
-           const trie<FullKey, PayloadTraits, PolicyHook>& b);
+operator==(const trie<FullKey, PayloadTraits, PolicyHook, AllocatorTraits>& a,
+           const trie<FullKey, PayloadTraits, PolicyHook, AllocatorTraits>& b);
 
-template<typename FullKey, typename PayloadTraits, typename PolicyHook>
+template<typename FullKey, typename PayloadTraits, typename PolicyHook, typename AllocatorTraits>
 std::size_t
-hash_value(const trie<FullKey, PayloadTraits, PolicyHook>& trie_node);
+hash_value(const trie<FullKey, PayloadTraits, PolicyHook, AllocatorTraits>& trie_node);
 
 ///////////////////////////////////////////////////
 // actual definition
@@ -126,7 +205,7 @@ class trie_iterator;
 template<class T>
 class trie_point_iterator;
 
-template<typename FullKey, typename PayloadTraits, typename PolicyHook>
+template<typename FullKey, typename PayloadTraits, typename PolicyHook, typename AllocatorTraits>
 class trie {
 public:
   typedef typename FullKey::value_type Key;
@@ -142,30 +221,26 @@ public:
 
   typedef PayloadTraits payload_traits;
 
+  /**
+   * @brief Create a root of the trie
+   *
+   * The root owns the allocator, which is shared by all nodes of the trie
+   */
   inline trie(const Key& key, size_t bucketSize = 1, size_t bucketIncrement = 1)
-    : key_(key)
-    , initialBucketSize_(bucketSize)
-    , bucketIncrement_(bucketIncrement)
-    , bucketSize_(initialBucketSize_)
-    , buckets_(new bucket_type[bucketSize_]) // cannot use normal pointer, because lifetime of
-                                             // buckets should be larger than lifetime of the
-                                             // container
-    , children_(bucket_traits(buckets_.get(), bucketSize_))
-    , payload_(PayloadTraits::empty_payload)
-    , parent_(nullptr)
+    : trie(key, boost::hash<Key>()(key), bucketSize, bucketIncrement, nullptr)
   {
   }
 
   inline ~trie()
   {
     payload_ = PayloadTraits::empty_payload; // necessary for smart pointers...
-    children_.clear_and_dispose(trie_delete_disposer());
+    children_.clear_and_dispose(trie_delete_disposer(allocator_));
   }
 
   void
   clear()
   {
-    children_.clear_and_dispose(trie_delete_disposer());
+    children_.clear_and_dispose(trie_delete_disposer(allocator_));
   }
 
   template<class Predicate>
@@ -184,21 +259,87 @@ public:
   }
 
   // actual entry
-  friend bool operator==<>(const trie<FullKey, PayloadTraits, PolicyHook>& a,
-                           const trie<FullKey, PayloadTraits, PolicyHook>& b);
+  friend bool operator==<>(const trie& a, const trie& b);
 
   friend std::size_t
-  hash_value<>(const trie<FullKey, PayloadTraits, PolicyHook>& trie_node);
+  hash_value<>(const trie& trie_node);
+
+  /**
+   * @brief Calculate hashes of all components of the key
+   *
+   * The hashes can be passed to insert, find, and find_if, so that a key that is used for several
+   * operations is hashed only once.  combine_hash of the hashes gives full_hash of the key's node.
+   */
+  static void
+  hash_components(const FullKey& key, std::vector<size_t>& hashes)
+  {
+    hashes.clear();
+    BOOST_FOREACH (const Key& subkey, key) {
+      hashes.push_back(boost::hash<Key>()(subkey));
+    }
+  }
+
+  /**
+   * @brief Extend hash of a prefix with hash of the next component
+   */
+  static size_t
+  combine_hash(size_t prefixHash, size_t componentHash)
+  {
+    boost::hash_combine(prefixHash, componentHash);
+    return prefixHash;
+  }
+
+  /**
+   * @brief Hash of the full key of the node, combining hashes of all components from the root
+   */
+  size_t
+  full_hash() const
+  {
+    if (parent_ == nullptr)
+      return 0;
+    return combine_hash(parent_->full_hash(), hash_);
+  }
+
+  /**
+   * @brief Check whether the full key of the node (path from the root) is equal to the key
+   */
+  bool
+  has_key(const FullKey& key) const
+  {
+    const trie* trieNode = this;
+    for (auto subkey = key.rbegin(); subkey != key.rend(); ++subkey) {
+      if (trieNode->parent_ == nullptr || !(trieNode->key_ == *subkey))
+        return false;
+      trieNode = trieNode->parent_;
+    }
+    return trieNode->parent_ == nullptr;
+  }
 
   inline std::pair<iterator, bool>
   insert(const FullKey& key, typename PayloadTraits::insert_type payload)
+  {
+    std::vector<size_t> hashes;
+    hash_components(key, hashes);
+    return insert(key, hashes, payload);
+  }
+
+  /**
+   * @brief Insert using hashes of key components, calculated in advance by hash_components
+   */
+  inline std::pair<iterator, bool>
+  insert(const FullKey& key, const std::vector<size_t>& hashes,
+         typename PayloadTraits::insert_type payload)
   {
     trie* trieNode = this;
+    size_t level = 0;
 
     BOOST_FOREACH (const Key& subkey, key) {
-      typename unordered_set::iterator item = trieNode->children_.find(subkey);
+      hashed_key lookupKey(subkey, hashes[level++]);
+      typename unordered_set::iterator item =
+        trieNode->children_.find(lookupKey, hashed_key_hash(), hashed_key_equal());
       if (item == trieNode->children_.end()) {
-        trie* newNode = new trie(subkey, initialBucketSize_, bucketIncrement_);
+        trie* newNode = allocator_->create_node(subkey, lookupKey.hash, initialBucketSize_,
+                                                bucketIncrement_, allocator_);
         // std::cout << "new " << newNode << "\n";
         newNode->parent_ = trieNode;
 
@@ -206,7 +347,8 @@ public:
           trieNode->bucketSize_ += trieNode->bucketIncrement_;
           trieNode->bucketIncrement_ *= 2; // increase bucketIncrement exponentially
 
-          buckets_array newBuckets(new bucket_type[trieNode->bucketSize_]);
+          buckets_array newBuckets(allocator_->allocate_buckets(trieNode->bucketSize_),
+                                   bucket_disposer(allocator_, trieNode->bucketSize_));
           trieNode->children_.rehash(bucket_traits(newBuckets.get(), trieNode->bucketSize_));
           trieNode->buckets_.swap(newBuckets);
         }
@@ -251,7 +393,8 @@ public:
       trie* parent = parent_;
       parent->children_
         .erase_and_dispose(*this,
-                           trie_delete_disposer()); // delete this; basically, committing a suicide
+                           trie_delete_disposer(allocator_)); // delete this; basically, committing
+                                                              // a suicide
 
       return parent->prune();
     }
@@ -271,7 +414,8 @@ public:
       trie* parent = parent_;
       parent->children_
         .erase_and_dispose(*this,
-                           trie_delete_disposer()); // delete this; basically, committing a suicide
+                           trie_delete_disposer(allocator_)); // delete this; basically, committing
+                                                              // a suicide
     }
   }
 
@@ -289,13 +433,28 @@ public:
    */
   inline std::tuple<iterator, bool, iterator>
   find(const FullKey& key)
+  {
+    std::vector<size_t> hashes;
+    hash_components(key, hashes);
+    return find(key, hashes);
+  }
+
+  /**
+   * @brief Perform the longest prefix match using hashes of key components, calculated in
+   *        advance by hash_components
+   */
+  inline std::tuple<iterator, bool, iterator>
+  find(const FullKey& key, const std::vector<size_t>& hashes)
   {
     trie* trieNode = this;
     iterator foundNode = (payload_ != PayloadTraits::empty_payload) ? this : 0;
     bool reachLast = true;
+    size_t level = 0;
 
     BOOST_FOREACH (const Key& subkey, key) {
-      typename unordered_set::iterator item = trieNode->children_.find(subkey);
+      typename unordered_set::iterator item =
+        trieNode->children_.find(hashed_key(subkey, hashes[level++]), hashed_key_hash(),
+                                 hashed_key_equal());
       if (item == trieNode->children_.end()) {
         reachLast = false;
         break;
@@ -320,13 +479,29 @@ public:
   template<class Predicate>
   inline std::tuple<iterator, bool, iterator>
   find_if(const FullKey& key, Predicate pred)
+  {
+    std::vector<size_t> hashes;
+    hash_components(key, hashes);
+    return find_if(key, hashes, pred);
+  }
+
+  /**
+   * @brief Perform the longest prefix match satisfying preficate using hashes of key components,
+   *        calculated in advance by hash_components
+   */
+  template<class Predicate>
+  inline std::tuple<iterator, bool, iterator>
+  find_if(const FullKey& key, const std::vector<size_t>& hashes, Predicate pred)
   {
     trie* trieNode = this;
     iterator foundNode = (payload_ != PayloadTraits::empty_payload) ? this : 0;
     bool reachLast = true;
+    size_t level = 0;
 
     BOOST_FOREACH (const Key& subkey, key) {
-      typename unordered_set::iterator item = trieNode->children_.find(subkey);
+      typename unordered_set::iterator item =
+        trieNode->children_.find(hashed_key(subkey, hashes[level++]), hashed_key_hash(),
+                                 hashed_key_equal());
       if (item == trieNode->children_.end()) {
         reachLast = false;
         break;
@@ -354,7 +529,6 @@ public:
     if (payload_ != PayloadTraits::empty_payload)
       return this;
 
-    typedef trie<FullKey, PayloadTraits, PolicyHook> trie;
     for (typename trie::unordered_set::iterator subnode = children_.begin();
          subnode != children_.end(); subnode++)
     // BOOST_FOREACH (trie &subnode, children_)
@@ -380,7 +554,6 @@ public:
     if (payload_ != PayloadTraits::empty_payload && pred(payload_))
       return this;
 
-    typedef trie<FullKey, PayloadTraits, PolicyHook> trie;
     for (typename trie::unordered_set::iterator subnode = children_.begin();
          subnode != children_.end(); subnode++)
     // BOOST_FOREACH (const trie &subnode, children_)
@@ -406,7 +579,6 @@ public:
   inline const iterator
   find_if_next_level(Predicate pred)
   {
-    typedef trie<FullKey, PayloadTraits, PolicyHook> trie;
     for (typename trie::unordered_set::iterator subnode = children_.begin();
          subnode != children_.end(); subnode++) {
       if (pred(subnode->key())) {
@@ -457,24 +629,6 @@ public:
   PrintStat(std::ostream& os) const;
 
 private:
-  // The disposer object function
-  struct trie_delete_disposer {
-    void
-    operator()(trie* delete_this)
-    {
-      delete delete_this;
-    }
-  };
-
-  template<class D>
-  struct array_disposer {
-    void
-    operator()(D* array)
-    {
-      delete[] array;
-    }
-  };
-
   friend std::ostream& operator<<<>(std::ostream& os, const trie& trie_node);
 
 public:
@@ -492,6 +646,113 @@ private:
   typedef typename unordered_set::bucket_type bucket_type;
   typedef typename unordered_set::bucket_traits bucket_traits;
 
+  typedef typename AllocatorTraits::template allocator<trie, bucket_type> allocator_type;
+  friend allocator_type;
+
+public:
+  /**
+   * @brief Get the allocator shared by all nodes of the trie (e.g., for memory usage statistics)
+   */
+  const allocator_type&
+  get_allocator() const
+  {
+    return *allocator_;
+  }
+
+private:
+
+  /**
+   * @brief Create a node that allocates its children and buckets from @p allocator
+   *
+   * If @p allocator is nullptr, the node becomes a root and creates its own allocator
+   */
+  inline trie(const Key& key, size_t hash, size_t bucketSize, size_t bucketIncrement,
+              allocator_type* allocator)
+    : key_(key)
+    , hash_(hash)
+    , initialBucketSize_(bucketSize)
+    , bucketIncrement_(bucketIncrement)
+    , bucketSize_(initialBucketSize_)
+    , ownAllocator_(allocator == nullptr ? new allocator_type : nullptr)
+    , allocator_(allocator == nullptr ? ownAllocator_.get() : allocator)
+    , buckets_(allocator_->allocate_buckets(bucketSize_),
+               bucket_disposer(allocator_, bucketSize_)) // cannot use normal pointer, because
+                                                         // lifetime of buckets should be larger
+                                                         // than lifetime of the container
+    , children_(bucket_traits(buckets_.get(), bucketSize_))
+    , payload_(PayloadTraits::empty_payload)
+    , parent_(nullptr)
+  {
+  }
+
+  // Allows looking up children by key and its precomputed hash without constructing a temporary
+  // trie node.  Hashes are compared first, so component bytes are compared only on a likely match
+  struct hashed_key {
+    hashed_key(const Key& key, size_t hash)
+      : key(key)
+      , hash(hash)
+    {
+    }
+
+    const Key& key;
+    size_t hash;
+  };
+
+  struct hashed_key_hash {
+    size_t
+    operator()(const hashed_key& key) const
+    {
+      return key.hash;
+    }
+  };
+
+  struct hashed_key_equal {
+    bool
+    operator()(const hashed_key& key, const trie& node) const
+    {
+      return key.hash == node.hash_ && key.key == node.key_;
+    }
+
+    bool
+    operator()(const trie& node, const hashed_key& key) const
+    {
+      return key.hash == node.hash_ && key.key == node.key_;
+    }
+  };
+
+  // The disposer object function
+  struct trie_delete_disposer {
+    trie_delete_disposer(allocator_type* allocator)
+      : allocator_(allocator)
+    {
+    }
+
+    void
+    operator()(trie* delete_this)
+    {
+      allocator_->destroy_node(delete_this);
+    }
+
+    allocator_type* allocator_;
+  };
+
+  struct bucket_disposer {
+    bucket_disposer(allocator_type* allocator = nullptr, size_t size = 0)
+      : allocator_(allocator)
+      , size_(size)
+    {
+    }
+
+    void
+    operator()(bucket_type* array)
+    {
+      allocator_->deallocate_buckets(array, size_);
+    }
+
+    allocator_type* allocator_;
+    size_t size_;
+  };
+
   template<class T, class NonConstT>
   friend class trie_iterator;
 
@@ -503,12 +764,18 @@ private:
   ////////////////////////////////////////////////
 
   Key key_; ///< name component
+  size_t hash_; ///< hash of the name component, calculated once when the node is created
 
   size_t initialBucketSize_;
   size_t bucketIncrement_;
 
   size_t bucketSize_;
-  typedef boost::interprocess::unique_ptr<bucket_type, array_disposer<bucket_type>> buckets_array;
+
+  // must be declared before buckets_, as the root's own buckets are returned to its allocator
+  std::unique_ptr<allocator_type> ownAllocator_; ///< set only for the root of the trie
+  allocator_type* allocator_;
+
+  typedef boost::interprocess::unique_ptr<bucket_type, bucket_disposer> buckets_array;
   buckets_array buckets_;
   unordered_set children_;
 
@@ -516,13 +783,14 @@ private:
   trie* parent_; // to make cleaning effective
 };
 
-template<typename FullKey, typename PayloadTraits, typename PolicyHook>
+template<typename FullKey, typename PayloadTraits, typename PolicyHook, typename AllocatorTraits>
 inline std::ostream&
-operator<<(std::ostream& os, const trie<FullKey, PayloadTraits, PolicyHook>& trie_node)
+operator<<(std::ostream& os,
+           const trie<FullKey, PayloadTraits, PolicyHook, AllocatorTraits>& trie_node)
 {
   os << "# " << trie_node.key_ << ((trie_node.payload_ != PayloadTraits::empty_payload) ? "*" : "")
      << std::endl;
-  typedef trie<FullKey, PayloadTraits, PolicyHook> trie;
+  typedef trie<FullKey, PayloadTraits, PolicyHook, AllocatorTraits> trie;
 
   for (typename trie::unordered_set::const_iterator subnode = trie_node.children_.begin();
        subnode != trie_node.children_.end(); subnode++)
@@ -546,9 +814,9 @@ operator<<(std::ostream& os, const trie<FullKey, PayloadTraits, PolicyHook>& tri
   return os;
 }
 
-template<typename FullKey, typename PayloadTraits, typename PolicyHook>
+template<typename FullKey, typename PayloadTraits, typename PolicyHook, typename AllocatorTraits>
 inline void
-trie<FullKey, PayloadTraits, PolicyHook>::PrintStat(std::ostream& os) const
+trie<FullKey, PayloadTraits, PolicyHook, AllocatorTraits>::PrintStat(std::ostream& os) const
 {
   os << "# " << key_ << ((payload_ != PayloadTraits::empty_payload) ? "*" : "") << ": "
      << children_.size() << " children" << std::endl;
@@ -557,7 +825,6 @@ trie<FullKey, PayloadTraits, PolicyHook>::PrintStat(std::ostream& os) const
   }
   os << "\n";
 
-  typedef trie<FullKey, PayloadTraits, PolicyHook> trie;
   for (typename trie::unordered_set::const_iterator subnode = children_.begin();
        subnode != children_.end(); subnode++)
   // BOOST_FOREACH (const trie &subnode, children_)
@@ -566,19 +833,19 @@ trie<FullKey, PayloadTraits, PolicyHook>::PrintStat(std::ostream& os) const
   }
 }
 
-template<typename FullKey, typename PayloadTraits, typename PolicyHook>
+template<typename FullKey, typename PayloadTraits, typename PolicyHook, typename AllocatorTraits>
 inline bool
-operator==(const trie<FullKey, PayloadTraits, PolicyHook>& a,
-           const trie<FullKey, PayloadTraits, PolicyHook>& b)
+operator==(const trie<FullKey, PayloadTraits, PolicyHook, AllocatorTraits>& a,
+           const trie<FullKey, PayloadTraits, PolicyHook, AllocatorTraits>& b)
 {
   return a.key_ == b.key_;
 }
 
-template<typename FullKey, typename PayloadTraits, typename PolicyHook>
+template<typename FullKey, typename PayloadTraits, typename PolicyHook, typename AllocatorTraits>
 inline std::size_t
-hash_value(const trie<FullKey, PayloadTraits, PolicyHook>& trie_node)
+hash_value(const trie<FullKey, PayloadTraits, PolicyHook, AllocatorTraits>& trie_node)
 {
-  return boost::hash_value(trie_node.key_);
+  return trie_node.hash_; // no need to re-hash the component on every rehash of the parent
 }
 
 template<class Trie, class NonConstTrie> // hack for boost < 1.47
@@ -0,0 +1,226 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "worker-processes.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace ns3 {
+
+namespace {
+
+const char RESULTS_FILE[] = "results.txt";
+
+int
+runTask(const WorkerProcesses::Task& task, size_t index)
+{
+  int exitCode = 0;
+  try {
+    task(index);
+  }
+  catch (const std::exception& e) {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    exitCode = 1;
+  }
+
+  std::cout.flush();
+  std::cerr.flush();
+  return exitCode;
+}
+
+WorkerProcesses::Status
+getStatus(int status)
+{
+  if (WIFEXITED(status)) {
+    bool isSuccessful = WEXITSTATUS(status) == 0;
+    return {isSuccessful, isSuccessful ? "ok" : "failed", 0};
+  }
+  if (WIFSIGNALED(status)) {
+    return {false, "killed(" + std::to_string(WTERMSIG(status)) + ")", 0};
+  }
+  return {false, "unknown", 0};
+}
+
+} // namespace
+
+size_t
+WorkerProcesses::Run(size_t nTasks, size_t nJobs, const Task& task,
+                     const FinishCallback& onFinish/* = nullptr*/)
+{
+  typedef std::chrono::steady_clock clock;
+
+  std::map<pid_t, std::pair<size_t, clock::time_point>> workers; // task index and start time
+  size_t nextTask = 0;
+  size_t nFinished = 0;
+  size_t nFailed = 0;
+
+  while (nFinished < nTasks) {
+    while (workers.size() < std::max<size_t>(nJobs, 1) && nextTask < nTasks) {
+      // buffered output would otherwise be written by both processes
+      std::cout.flush();
+      std::cerr.flush();
+
+      pid_t pid = fork();
+      if (pid < 0) {
+        throw Error("Cannot start a worker process: " + std::string(std::strerror(errno)));
+      }
+      if (pid == 0) {
+        // skip destructors of static objects, which belong to the calling process
+        _exit(runTask(task, nextTask));
+      }
+      workers[pid] = {nextTask, clock::now()};
+      ++nextTask;
+    }
+
+    int status = 0;
+    pid_t pid = waitpid(-1, &status, 0);
+    if (pid < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw Error("Cannot wait for worker processes: " + std::string(std::strerror(errno)));
+    }
+    auto worker = workers.find(pid);
+    if (worker == workers.end()) {
+      continue;
+    }
+
+    size_t index = worker->second.first;
+    Status taskStatus = getStatus(status);
+    taskStatus.wallTime = std::chrono::duration<double>(clock::now() - worker->second.second)
+                            .count();
+    workers.erase(worker);
+
+    ++nFinished;
+    if (!taskStatus.isSuccessful) {
+      ++nFailed;
+    }
+    if (onFinish != nullptr) {
+      onFinish(index, taskStatus);
+    }
+  }
+
+  return nFailed;
+}
+
+void
+WorkerProcesses::RedirectOutput(const std::string& file)
+{
+  std::cout.flush();
+  std::cerr.flush();
+
+  int fd = open(file.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    throw Error("Cannot open " + file + ": " + std::string(std::strerror(errno)));
+  }
+  dup2(fd, STDOUT_FILENO);
+  dup2(fd, STDERR_FILENO);
+  close(fd);
+}
+
+void
+WorkerProcesses::PrepareResultsDirectory(const std::string& dir)
+{
+  boost::filesystem::create_directories(dir);
+  boost::filesystem::remove(dir + "/" + RESULTS_FILE);
+}
+
+void
+WorkerProcesses::WriteResults(const std::string& dir, const Results& results)
+{
+  std::ofstream os(dir + "/" + RESULTS_FILE, std::ios_base::out | std::ios_base::trunc);
+  for (const auto& result : results) {
+    os << result.first << "\t" << result.second << "\n";
+  }
+  if (!os) {
+    throw Error("Cannot write results into " + dir);
+  }
+}
+
+WorkerProcesses::Results
+WorkerProcesses::ReadResults(const std::string& dir)
+{
+  Results results;
+  std::ifstream is(dir + "/" + RESULTS_FILE);
+  std::string name;
+  std::string value;
+  while (std::getline(is, name, '\t') && std::getline(is, value)) {
+    results.push_back({name, value});
+  }
+  return results;
+}
+
+void
+WorkerProcesses::WriteSummary(const std::string& file, const std::vector<std::string>& columns,
+                              const std::vector<std::vector<std::string>>& fields,
+                              const std::vector<Status>& statuses,
+                              const std::vector<Results>& results)
+{
+  std::vector<std::string> resultNames;
+  for (const auto& taskResults : results) {
+    for (const auto& result : taskResults) {
+      if (std::find(resultNames.begin(), resultNames.end(), result.first) == resultNames.end()) {
+        resultNames.push_back(result.first);
+      }
+    }
+  }
+
+  std::ofstream os(file, std::ios_base::out | std::ios_base::trunc);
+  if (!os.is_open()) {
+    throw Error("Cannot open " + file + " for writing");
+  }
+
+  for (const auto& column : columns) {
+    os << column << "\t";
+  }
+  os << "Status\tWallTime";
+  for (const auto& name : resultNames) {
+    os << "\t" << name;
+  }
+  os << "\n";
+
+  for (size_t index = 0; index < statuses.size(); ++index) {
+    for (const auto& field : fields.at(index)) {
+      os << field << "\t";
+    }
+    os << statuses[index].description << "\t" << statuses[index].wallTime;
+
+    std::map<std::string, std::string> taskResults(results.at(index).begin(),
+                                                   results.at(index).end());
+    for (const auto& name : resultNames) {
+      auto result = taskResults.find(name);
+      os << "\t" << (result != taskResults.end() ? result->second : "NA");
+    }
+    os << "\n";
+  }
+}
+
+} // namespace ns3
@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2018  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_WORKER_PROCESSES_HPP
+#define NDNSIM_UTILS_WORKER_PROCESSES_HPP
+
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Executes independent tasks in worker processes forked from the calling process
+ *
+ * Each worker starts as a copy-on-write copy of the calling process, so a task can use all
+ * simulator state created before Run (e.g., topology, installed stacks and applications, and
+ * scheduled events) without affecting other tasks.  The calling process must not have running
+ * threads other than the main one (e.g., background trace writers).
+ *
+ * Tasks that produce named results can pass them to the calling process through their output
+ * directories (see WriteResults and ReadResults), and the calling process can collect them into
+ * a summary table (see WriteSummary).
+ */
+class WorkerProcesses {
+public:
+  class Error : public std::runtime_error {
+  public:
+    explicit Error(const std::string& what)
+      : std::runtime_error(what)
+    {
+    }
+  };
+
+  /**
+   * @brief Outcome of a task
+   */
+  struct Status {
+    bool isSuccessful;
+    std::string description; ///< @brief "ok", "failed", or "killed(<signal number>)"
+    double wallTime;         ///< @brief seconds from the start of the worker until its exit
+  };
+
+  /**
+   * @brief Named results of a task
+   */
+  typedef std::vector<std::pair<std::string, std::string>> Results;
+
+  /**
+   * @brief Task executed in a worker process; the task fails if it throws an exception
+   */
+  typedef std::function<void(size_t index)> Task;
+
+  /**
+   * @brief Callback called in the calling process when the worker of a task exits
+   */
+  typedef std::function<void(size_t index, const Status& status)> FinishCallback;
+
+  /**
+   * @brief Execute tasks with indices from 0 to @p nTasks - 1, at most @p nJobs at a time
+   *
+   * @return number of failed tasks
+   * @throw Error a worker process cannot be started
+   */
+  static size_t
+  Run(size_t nTasks, size_t nJobs, const Task& task, const FinishCallback& onFinish = nullptr);
+
+  /**
+   * @brief Redirect the standard output and error of the calling process to @p file
+   *
+   * Useful at the start of a task, so the output of parallel tasks is not interleaved.
+   */
+  static void
+  RedirectOutput(const std::string& file);
+
+  /**
+   * @brief Create the output directory @p dir of a task and remove results left in it
+   *
+   * Should be called in the calling process before Run, so results of a previous execution are
+   * not attributed to a task that fails.
+   */
+  static void
+  PrepareResultsDirectory(const std::string& dir);
+
+  /**
+   * @brief Write results of a task into results.txt in @p dir
+   * @throw Error the file cannot be written
+   */
+  static void
+  WriteResults(const std::string& dir, const Results& results);
+
+  /**
+   * @brief Read results written by WriteResults into @p dir
+   * @return the results, or no results if the file does not exist
+   */
+  static Results
+  ReadResults(const std::string& dir);
+
+  /**
+   * @brief Write a tab-separated summary table with one row per task
+   *
+   * Row i starts with @p fields[i], named by @p columns, followed by the Status and WallTime
+   * columns of @p statuses[i] and the values of @p results[i].  There is a column for each
+   * result name of any task, in order of appearance, and results missing for a task are
+   * written as NA.
+   *
+   * @throw Error the file cannot be written
+   */
+  static void
+  WriteSummary(const std::string& file, const std::vector<std::string>& columns,
+               const std::vector<std::vector<std::string>>& fields,
+               const std::vector<Status>& statuses, const std::vector<Results>& results);
+};
+
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_WORKER_PROCESSES_HPP